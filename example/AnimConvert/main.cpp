@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <filesystem>
+
+#include "GNEngine/manager/AnimationManager.h"
+
+/*
+ * AnimConvert - 애니메이션 JSON을 .gnanim(스키마: asset/text/fbs/animation.fbs)으로 변환함.
+ * 출력 경로를 생략하면 입력 파일 옆에 확장자만 바꿔 저장함. AnimationManager::loadAnimation은
+ * JSON보다 새로운 .gnanim이 옆에 있으면 JSON 대신 그것을 읽으므로, 에셋을 고칠 때마다 다시 실행하면 됨.
+ *
+ * 사용법: AnimConvert <input.json> [output.gnanim] [<input2.json> ...]
+ *         입력이 여러 개면 각각 옆에 저장함.
+ */
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: AnimConvert <input.json> [output.gnanim]\n"
+                             "       AnimConvert <input1.json> <input2.json> ...\n");
+        return 1;
+    }
+
+    const bool hasExplicitOutput = argc == 3 && std::filesystem::path(argv[2]).extension() == AnimationManager::BINARY_EXTENSION;
+    int failedCount = 0;
+    for (int i = 1; i < (hasExplicitOutput ? 2 : argc); ++i) {
+        const std::filesystem::path inputPath = argv[i];
+        std::filesystem::path outputPath = hasExplicitOutput ? std::filesystem::path(argv[2]) : inputPath;
+        if (!hasExplicitOutput) {
+            outputPath.replace_extension(AnimationManager::BINARY_EXTENSION);
+        }
+
+        if (AnimationManager::convertJsonToBinary(inputPath, outputPath)) {
+            std::printf("%s -> %s\n", inputPath.string().c_str(), outputPath.string().c_str());
+        } else {
+            std::fprintf(stderr, "Failed to convert %s\n", inputPath.string().c_str());
+            ++failedCount;
+        }
+    }
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GNEngine/manager/EntityManager.h"
+#include "GNEngine/manager/RenderManager.h"
+#include "GNEngine/manager/JobManager.h"
+#include "GNEngine/manager/CaptureManager.h"
+#include "GNEngine/system/AnimationSystem.h"
+#include "GNEngine/system/RenderSystem.h"
+#include "GNEngine/component/TransformComponent.h"
+#include "GNEngine/component/VelocityComponent.h"
+#include "GNEngine/component/RenderComponent.h"
+#include "GNEngine/component/AnimationComponent.h"
+#include "GNEngine/core/Animation.h"
+#include "GNEngine/core/SoftwareRasterizer.h"
+
+/*
+ * BunnyMark - 헤드리스 렌더링 벤치마크.
+ * bunnysheet.png의 달리기 애니메이션을 가진 스프라이트 N개를 EntityManager/RenderSystem 경로로 그리고,
+ * 화면 대신 오프스크린 소프트웨어 렌더러(SDL_CreateSoftwareRenderer)에 출력함.
+ * --cpu-raster를 주면 SDL 렌더러 대신 엔진의 멀티스레드 타일 래스터라이저(SoftwareRasterizer)로 그림. 0이면 스레드 수 자동.
+ * --capture를 주면 측정 프레임을 <dir>/<N>/frame_xxxxxx.png로 저장함. 인코딩은 CaptureManager 워커가 하므로 프레임 시간에는 읽기 비용만 들어감.
+ * N마다 프레임 시간 백분위수, 프레임당 드로우 콜 수, 초당 스프라이트 수를 JSON 한 줄씩 출력함.
+ *
+ * 사용법: BunnyMark [--counts 1000,5000,...] [--frames 120] [--warmup 10] [--width 1280] [--height 720]
+ *                  [--cpu-raster <threads>] [--capture <dir>] [--out result.jsonl]
+ */
+
+namespace {
+
+constexpr int FRAME_SIZE = 40;        /* bunnysheet 아랫줄 한 칸의 크기 */
+constexpr int RUN_FRAME_ROW_Y = 280;  /* 달리기 프레임이 있는 줄의 y */
+constexpr int RUN_FRAME_COUNT = 8;
+constexpr int RUN_FRAME_DURATION_MS = 100;
+constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f; /* 결과 재현성을 위해 고정 델타 사용 */
+
+struct BenchConfig {
+    std::vector<int> counts = {1000, 5000, 10000, 50000, 100000, 250000, 500000};
+    int frames = 120;
+    int warmupFrames = 10;
+    int width = 1280;
+    int height = 720;
+    int rasterThreads = -1; /* 0 이상이면 CPU 래스터라이저 사용 */
+    std::string capturePath;
+    std::string outPath;
+};
+
+struct BenchResult {
+    int spriteCount = 0;
+    int frames = 0;
+    double meanMs = 0.0;
+    double p50Ms = 0.0;
+    double p90Ms = 0.0;
+    double p99Ms = 0.0;
+    double maxMs = 0.0;
+    double drawCallsPerFrame = 0.0;
+    double spritesPerSec = 0.0;
+};
+
+std::vector<int> parseCounts(const char* text) {
+    std::vector<int> counts;
+    std::string token;
+    for (const char* c = text;; ++c) {
+        if (*c == ',' || *c == '\0') {
+            if (!token.empty()) {
+                const int count = std::atoi(token.c_str());
+                if (count > 0) counts.push_back(count);
+                token.clear();
+            }
+            if (*c == '\0') break;
+        } else {
+            token.push_back(*c);
+        }
+    }
+    return counts;
+}
+
+bool parseArgs(int argc, char* argv[], BenchConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--counts" && hasValue) {
+            config.counts = parseCounts(argv[++i]);
+        } else if (arg == "--frames" && hasValue) {
+            config.frames = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "--warmup" && hasValue) {
+            config.warmupFrames = std::max(std::atoi(argv[++i]), 0);
+        } else if (arg == "--width" && hasValue) {
+            config.width = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "--height" && hasValue) {
+            config.height = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "--cpu-raster" && hasValue) {
+            config.rasterThreads = std::max(std::atoi(argv[++i]), 0);
+        } else if (arg == "--capture" && hasValue) {
+            config.capturePath = argv[++i];
+        } else if (arg == "--out" && hasValue) {
+            config.outPath = argv[++i];
+        } else {
+            SDL_Log("BunnyMark - Unknown or incomplete argument: %s", arg.c_str());
+            return false;
+        }
+    }
+    return !config.counts.empty();
+}
+
+/* 정렬된 샘플에서 nearest-rank 방식으로 백분위수를 구함. */
+double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const size_t rank = static_cast<size_t>(p / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+/* 화면 경계에서 튕기도록 SoA 컬럼을 직접 갱신함. 게임 로직 비용을 최소로 두기 위함. */
+void updateBunnies(EntityManager& entityManager, float deltaTime, float halfWidth, float halfHeight) {
+    auto transforms = entityManager.getComponentArray<TransformComponent>();
+    auto velocities = entityManager.getComponentArray<VelocityComponent>();
+    auto& posX = transforms->positionX;
+    auto& posY = transforms->positionY;
+    auto& vx = velocities->vx;
+    auto& vy = velocities->vy;
+
+    /* 모든 엔티티가 두 컴포넌트를 같은 순서로 추가했으므로 인덱스가 일치함. */
+    const size_t count = std::min(posX.size(), vx.size());
+    for (size_t i = 0; i < count; ++i) {
+        posX[i] += vx[i] * deltaTime;
+        posY[i] += vy[i] * deltaTime;
+        if (posX[i] < -halfWidth || posX[i] > halfWidth) {
+            vx[i] = -vx[i];
+            posX[i] = std::clamp(posX[i], -halfWidth, halfWidth);
+        }
+        if (posY[i] < -halfHeight || posY[i] > halfHeight) {
+            vy[i] = -vy[i];
+            posY[i] = std::clamp(posY[i], -halfHeight, halfHeight);
+        }
+    }
+}
+
+BenchResult runBench(RenderManager& renderManager, CaptureManager* captureManager, SDL_Texture* texture,
+                     const std::shared_ptr<Animation>& animation, const BenchConfig& config, int spriteCount) {
+    /* N마다 새 EntityManager를 만들어 이전 실행의 상태가 섞이지 않게 함. */
+    EntityManager entityManager;
+    entityManager.registerComponentType<TransformComponent>();
+    entityManager.registerComponentType<VelocityComponent>();
+    entityManager.registerComponentType<RenderComponent>();
+    entityManager.registerComponentType<AnimationComponent>();
+
+    RenderSystem renderSystem(renderManager);
+    renderSystem.setPresentSkipping(false); // 매 프레임 전부 움직이므로 변경 감지 비용을 빼고 측정함
+    AnimationSystem animationSystem;
+
+    const float halfWidth = config.width * 0.5f;
+    const float halfHeight = config.height * 0.5f;
+    const SDL_Rect firstFrame = animation->getFrame(0);
+    const AnimationHandle animationHandle = animation->getHandle();
+
+    uint32_t seed = 0x9E3779B9u;
+    auto nextRandom = [&seed]() {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return static_cast<float>(seed & 0xFFFFFF) / static_cast<float>(0xFFFFFF);
+    };
+
+    for (int i = 0; i < spriteCount; ++i) {
+        const EntityID entity = entityManager.createEntity();
+        entityManager.addComponent<TransformComponent>(entity, (nextRandom() * 2.0f - 1.0f) * halfWidth, (nextRandom() * 2.0f - 1.0f) * halfHeight);
+        entityManager.addComponent<VelocityComponent>(entity, (nextRandom() * 2.0f - 1.0f) * 200.0f, (nextRandom() * 2.0f - 1.0f) * 200.0f);
+        entityManager.addComponent<RenderComponent>(entity, texture, RenderLayer::GAME_OBJECT, false, true, FRAME_SIZE, FRAME_SIZE, firstFrame);
+        entityManager.addComponent<AnimationComponent>(entity, animationHandle);
+    }
+
+    renderManager.setCameraPosition(0.0f, 0.0f);
+
+    std::vector<double> frameMs;
+    frameMs.reserve(config.frames);
+    uint64_t totalDrawCalls = 0;
+    const double ticksToMs = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+
+    for (int frame = 0; frame < config.warmupFrames + config.frames; ++frame) {
+        if (captureManager && frame == config.warmupFrames) {
+            captureManager->startRecording(std::filesystem::path(config.capturePath) / std::to_string(spriteCount));
+        }
+        renderManager.getSpriteBatch().resetStats();
+        const uint64_t start = SDL_GetPerformanceCounter();
+
+        updateBunnies(entityManager, FIXED_DELTA_TIME, halfWidth, halfHeight);
+        animationSystem.update(entityManager, FIXED_DELTA_TIME);
+        renderSystem.update(entityManager, FIXED_DELTA_TIME);
+        renderManager.present();
+
+        const uint64_t end = SDL_GetPerformanceCounter();
+        if (frame >= config.warmupFrames) {
+            frameMs.push_back(static_cast<double>(end - start) * ticksToMs);
+            totalDrawCalls += renderManager.getSpriteBatch().getDrawCallCount();
+        }
+    }
+
+    if (captureManager) {
+        captureManager->stopRecording();
+        captureManager->flush();
+        captureManager->logStats();
+    }
+
+    BenchResult result;
+    result.spriteCount = spriteCount;
+    result.frames = static_cast<int>(frameMs.size());
+
+    double totalMs = 0.0;
+    for (double ms : frameMs) totalMs += ms;
+    std::sort(frameMs.begin(), frameMs.end());
+
+    result.meanMs = totalMs / result.frames;
+    result.p50Ms = percentile(frameMs, 50.0);
+    result.p90Ms = percentile(frameMs, 90.0);
+    result.p99Ms = percentile(frameMs, 99.0);
+    result.maxMs = frameMs.back();
+    result.drawCallsPerFrame = static_cast<double>(totalDrawCalls) / result.frames;
+    result.spritesPerSec = totalMs > 0.0 ? static_cast<double>(spriteCount) * result.frames / (totalMs / 1000.0) : 0.0;
+
+    /* RenderComponent의 swapAndPop은 텍스처를 해제하므로 공유 텍스처를 가진 엔티티는 파괴하지 않고 EntityManager째 버림. */
+    return result;
+}
+
+void writeResult(FILE* out, const BenchResult& result, const BenchConfig& config) {
+    std::fprintf(out,
+        "{\"bench\":\"bunnymark\",\"renderer\":\"%s\",\"width\":%d,\"height\":%d,"
+        "\"sprites\":%d,\"frames\":%d,\"mean_ms\":%.4f,\"p50_ms\":%.4f,\"p90_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f,"
+        "\"draw_calls_per_frame\":%.2f,\"sprites_per_sec\":%.0f}\n",
+        config.rasterThreads >= 0 ? "cpu_tiled" : "software", config.width, config.height, result.spriteCount, result.frames, result.meanMs, result.p50Ms, result.p90Ms,
+        result.p99Ms, result.maxMs, result.drawCallsPerFrame, result.spritesPerSec);
+    std::fflush(out);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    if (!parseArgs(argc, argv, config)) {
+        SDL_Log("Usage: BunnyMark [--counts 1000,5000] [--frames 120] [--warmup 10] [--width 1280] [--height 720] "
+                "[--cpu-raster <threads>] [--capture <dir>] [--out result.jsonl]");
+        return 1;
+    }
+
+    /* 창을 띄우지 않도록 오프스크린 비디오 드라이버를 사용함. */
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_Log("BunnyMark - SDL_Init failed: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Surface* target = SDL_CreateSurface(config.width, config.height, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    if (!renderer) {
+        SDL_Log("BunnyMark - Failed to create software renderer: %s", SDL_GetError());
+        SDL_DestroySurface(target);
+        SDL_Quit();
+        return 1;
+    }
+
+    /* CPU 래스터라이저에 픽셀 사본을 등록해야 하므로 서피스를 거쳐 텍스처를 만듦. */
+    SDL_Surface* spriteSurface = IMG_Load(BUNNYMARK_SPRITE_PATH);
+    SDL_Texture* texture = spriteSurface ? SDL_CreateTextureFromSurface(renderer, spriteSurface) : nullptr;
+    if (!texture) {
+        SDL_Log("BunnyMark - Failed to load %s: %s", BUNNYMARK_SPRITE_PATH, SDL_GetError());
+        SDL_DestroySurface(spriteSurface);
+        SDL_DestroyRenderer(renderer);
+        SDL_DestroySurface(target);
+        SDL_Quit();
+        return 1;
+    }
+
+    auto animation = std::make_shared<Animation>(BUNNYMARK_SPRITE_PATH, true);
+    for (int i = 0; i < RUN_FRAME_COUNT; ++i) {
+        animation->addFrame({i * FRAME_SIZE, RUN_FRAME_ROW_Y, FRAME_SIZE, FRAME_SIZE}, RUN_FRAME_DURATION_MS);
+    }
+
+    FILE* out = stdout;
+    if (!config.outPath.empty()) {
+        out = std::fopen(config.outPath.c_str(), "w");
+        if (!out) {
+            SDL_Log("BunnyMark - Failed to open %s", config.outPath.c_str());
+            out = stdout;
+        }
+    }
+
+    {
+        RenderManager renderManager(renderer, nullptr);
+        SDL_Rect viewport = {0, 0, config.width, config.height};
+        renderManager.setViewport(viewport);
+
+        std::unique_ptr<JobManager> jobManager;
+        std::unique_ptr<SoftwareRasterizer> rasterizer;
+        if (config.rasterThreads >= 0) {
+            jobManager = std::make_unique<JobManager>(static_cast<size_t>(config.rasterThreads));
+            rasterizer = std::make_unique<SoftwareRasterizer>(*jobManager, config.width, config.height);
+            rasterizer->addTexture(texture, spriteSurface);
+            renderManager.setRasterizer(rasterizer.get(), false);
+        }
+
+        std::unique_ptr<CaptureManager> captureManager;
+        if (!config.capturePath.empty()) {
+            captureManager = std::make_unique<CaptureManager>();
+            renderManager.setCaptureManager(captureManager.get());
+        }
+
+        for (int spriteCount : config.counts) {
+            const BenchResult result = runBench(renderManager, captureManager.get(), texture, animation, config, spriteCount);
+            writeResult(out, result, config);
+        }
+        renderManager.setCaptureManager(nullptr);
+        renderManager.setRasterizer(nullptr);
+    }
+
+    if (out != stdout) std::fclose(out);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroySurface(spriteSurface);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroySurface(target);
+    SDL_Quit();
+    return 0;
+}
@@ -17,8 +17,11 @@
 #include "GNEngine/system/CameraSystem.h"
 #include "GNEngine/system/InputToAccelerationSystem.h"
 #include "GNEngine/system/PlayerAnimationControlSystem.h"
+#include "GNEngine/system/AnimationStateMachineSystem.h"
 #include "GNEngine/system/FadeSystem.h"
 #include "GNEngine/system/TextSystem.h"
+#include "GNEngine/system/TilemapRenderSystem.h"
+#include "GNEngine/system/ParticleSystem.h"
 
 /* --- Include All Components to use --- */
 #include "GNEngine/component/SoundComponent.h"
@@ -32,7 +35,10 @@
 #include "GNEngine/component/TextComponent.h"
 #include "GNEngine/component/FadeComponent.h"
 #include "GNEngine/component/PlayerAnimationControllerComponent.h"
+#include "GNEngine/component/AnimationStateMachineComponent.h"
 #include "GNEngine/component/PlayerMovementComponent.h"
+#include "GNEngine/component/TilemapComponent.h"
+#include "GNEngine/component/ParticleEmitterComponent.h"
 
 /* --- Include All Scenes to use --- */
 #include "scene/LogoScene.h"
@@ -69,6 +75,11 @@ int Application::init(){
     /* Set additional settings */
     SDL_SetRenderVSync(renderer_, true); /* Enable VSync */
 
+    /* present를 건너뛴 프레임에서 쉴 시간. 모니터 주사율을 따르고, 알 수 없으면 60Hz로 봄 */
+    const SDL_DisplayMode* displayMode = SDL_GetCurrentDisplayMode(SDL_GetDisplayForWindow(window_));
+    const float refreshRate = (displayMode && displayMode->refresh_rate > 0.0f) ? displayMode->refresh_rate : 60.0f;
+    idleFrameInterval_ = std::chrono::nanoseconds(static_cast<long long>(1'000'000'000.0 / refreshRate));
+
 
     /* ※Do not change the order of declarations.※ */
     /* (The order of declaration is the same as the order of destruction.) */
@@ -84,21 +95,42 @@ int Application::init(){
     systemManager_ = std::make_unique<SystemManager>(*entityManager_);
     sceneManager_ = std::make_unique<SceneManager>();
     renderManager_ = std::make_unique<RenderManager>(renderer_, window_);
+    renderManager_->setTextureManager(textureManager_.get()); // 축소본 캐시는 textureManager_->enableScaledVariants로 켬
 
     SDL_Rect viewport = {0, 0, windowWidth, windowHeight}; //RenderManager이나 다른 클래스로 이항 예정.
     renderManager_->setViewport(viewport);
 
     /* --- Regist all systems --- */
-    systemManager_->registerSystem<RenderSystem>(SystemPhase::RENDER, *renderManager_);
+    auto renderSystem = systemManager_->registerSystem<RenderSystem>(SystemPhase::RENDER, *renderManager_);
+    renderSystem->setLayerStatic(RenderLayer::BACKGROUND_FAR, true);
+    renderSystem->setLayerStatic(RenderLayer::BACKGROUND_MID, true);
+    renderSystem->setLayerStatic(RenderLayer::BACKGROUND_NEAR, true);
     systemManager_->registerSystem<InputSystem>(SystemPhase::PRE_UPDATE, *eventManager_, *entityManager_);
     systemManager_->registerSystem<PlayerAnimationControlSystem>(SystemPhase::LOGIC_UPDATE, *animationManager_, *textureManager_, *renderManager_);
-    systemManager_->registerSystem<SoundSystem>(SystemPhase::LOGIC_UPDATE, *soundManager_);
+    systemManager_->registerSystem<AnimationStateMachineSystem>(SystemPhase::LOGIC_UPDATE);
+    auto soundSystem = systemManager_->registerSystem<SoundSystem>(SystemPhase::LOGIC_UPDATE, *soundManager_);
     systemManager_->registerSystem<CameraSystem>(SystemPhase::POST_UPDATE, *renderManager_);
-    systemManager_->registerSystem<AnimationSystem>(SystemPhase::POST_UPDATE);
+    auto animationSystem = systemManager_->registerSystem<AnimationSystem>(SystemPhase::POST_UPDATE);
+    soundSystem->setAnimationEventSource(animationSystem.get());
+    // T.C.json의 걷기 프레임에 달린 발소리 이벤트
+    soundSystem->mapAnimationEvent(AnimationTable::instance().registerEvent("footstep"),
+                                   soundManager_->getSound(std::filesystem::path(SOUND_EFFECT_ASSET_ROOT_PATH) / "hit01.flac"), SoundPriority::LOW, 0.3f);
     systemManager_->registerSystem<InputToAccelerationSystem>(SystemPhase::PRE_UPDATE, *eventManager_, *entityManager_);
     systemManager_->registerSystem<MovementSystem>(SystemPhase::PHYSICS_UPDATE);
     systemManager_->registerSystem<FadeSystem>(SystemPhase::LOGIC_UPDATE, *renderManager_);
     systemManager_->registerSystem<TextSystem>(SystemPhase::LOGIC_UPDATE, *entityManager_, *textManager_, renderer_);
+    auto tilemapRenderSystem = systemManager_->registerSystem<TilemapRenderSystem>(SystemPhase::POST_UPDATE, *renderManager_);
+    renderSystem->addLayerRenderer([tilemapRenderSystem](EntityManager& entityManager, RenderLayer layer) {
+        tilemapRenderSystem->renderLayer(entityManager, layer);
+    }, [tilemapRenderSystem](EntityManager& entityManager) {
+        return tilemapRenderSystem->getRevision(entityManager);
+    });
+    auto particleSystem = systemManager_->registerSystem<ParticleSystem>(SystemPhase::PHYSICS_UPDATE, *renderManager_);
+    renderSystem->addLayerRenderer([particleSystem](EntityManager& entityManager, RenderLayer layer) {
+        particleSystem->renderLayer(entityManager, layer);
+    }, [particleSystem](EntityManager&) {
+        return particleSystem->getRevision();
+    });
 
     /* --- Regist all Conpontnt to use --- */
     entityManager_->registerComponentType<RenderComponent>();
@@ -110,8 +142,22 @@ int Application::init(){
     entityManager_->registerComponentType<FadeComponent>();
     entityManager_->registerComponentType<AccelerationComponent>();
     entityManager_->registerComponentType<PlayerAnimationControllerComponent>();
+    entityManager_->registerComponentType<AnimationStateMachineComponent>();
     entityManager_->registerComponentType<InputControlComponent>();
     entityManager_->registerComponentType<CameraComponent>();
+    entityManager_->registerComponentType<TilemapComponent>();
+    entityManager_->registerComponentType<ParticleEmitterComponent>();
+
+    /* --- Load shared animation assets --- */
+    // 상태 머신은 클립 이름으로 상태를 만들므로 T.C.json을 먼저 불러옴. 플레이어를 몇 번 만들든 한 번만 읽음
+    std::filesystem::path tcAnimationJsonPath = std::filesystem::path(ANIMATION_SHEET_ASSET_ROOT_PATH) / "T.C/" / "T.C.json";
+    if (!animationManager_->loadAnimation(tcAnimationJsonPath)) {
+        std::cerr << "Error: Failed to load animation JSON: " << tcAnimationJsonPath << std::endl;
+    }
+    std::filesystem::path tcStateMachinePath = std::filesystem::path(ANIMATION_SHEET_ASSET_ROOT_PATH) / "T.C/" / "T.C.states.json";
+    if (!animationManager_->loadStateMachine(tcStateMachinePath)) {
+        std::cerr << "Error: Failed to load state machine JSON: " << tcStateMachinePath << std::endl;
+    }
 
 
     /* --- Regist all scenes ---*/
@@ -176,8 +222,6 @@ void Application::run() {
         }
         inputManager_->updateKeyStates();
 
-        renderManager_->clear();
-
         /*
         * SystemManager perform in the order. {PRE_UPDATE, LOGIT_UPDATE, PHYSICS_UPDATE, POST_UPDATE, RENDER}
         */
@@ -189,5 +233,13 @@ void Application::run() {
         sceneManager_->update(deltaTime);
 
         renderManager_->present();
+
+        /* 화면이 그대로라 present를 건너뛴 프레임은 VSync 대기가 없으므로 남은 프레임 시간만큼 쉼 */
+        if (renderManager_->wasLastPresentSkipped()) {
+            const auto frameTime = std::chrono::high_resolution_clock::now() - currentTime;
+            if (frameTime < idleFrameInterval_) {
+                SDL_DelayPrecise(static_cast<Uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(idleFrameInterval_ - frameTime).count()));
+            }
+        }
     }
 }
\ No newline at end of file
@@ -33,6 +33,7 @@ private:
     bool isRunning_ = false;
 
     std::chrono::high_resolution_clock::time_point lastFrameTime_;
+    std::chrono::nanoseconds idleFrameInterval_{16'666'667}; /* 화면 변화가 없어 present를 건너뛴 프레임의 최소 길이 */
 
     // Managers (formerly owned by GNManager)
     std::unique_ptr<EntityManager> entityManager_;
@@ -17,6 +17,7 @@
 #include "GNEngine/component/RenderComponent.h"
 #include "GNEngine/component/SoundComponent.h"
 #include "GNEngine/component/PlayerAnimationControllerComponent.h"
+#include "GNEngine/component/AnimationStateMachineComponent.h"
 #include "GNEngine/component/PlayerMovementComponent.h"
 #include "GNEngine/component/InputControlComponent.h"
 
@@ -36,13 +37,7 @@ EntityID PlayerPrefab::create(EntityManager& entityManager, EventManager& eventM
     entityManager.addComponent<AccelerationComponent>(entityId, 0.0f, 0.0f);
 
     // PlayerAnimationControllerComponent 추가
-    // 애니메이션 데이터 로드
-    // T.C.json 파일 하나로 모든 애니메이션 로드
-    std::filesystem::path tcAnimationJsonPath = std::filesystem::path(ANIMATION_SHEET_ASSET_ROOT_PATH) / "T.C/" / "T.C.json";
-    if (!animationManager.loadAnimation(tcAnimationJsonPath)) {
-        std::cerr << "Error: Failed to load animation JSON: " << tcAnimationJsonPath << std::endl;
-    }
-    
+    // 애니메이션 데이터(T.C.json)와 상태 머신(T.C.states.json)은 Application 초기화 때 한 번 불러 둠
     std::shared_ptr<Animation> tcIdleAnimationData = animationManager.getAnimation("idle");
     std::shared_ptr<Animation> tcWalkAnimationData = animationManager.getAnimation("walk");
     std::shared_ptr<Animation> tcJumpAnimationData = animationManager.getAnimation("jump");
@@ -70,9 +65,14 @@ EntityID PlayerPrefab::create(EntityManager& entityManager, EventManager& eventM
 
     entityManager.addComponent<PlayerAnimationControllerComponent>(entityId, tcWalkAnimationData, tcJumpAnimationData, tcIdleAnimationData);
 
-    // AnimationComponent 추가: PlayerAnimationControllerComponent에서 사용할 기본 애니메이션으로 초기화
+    // AnimationComponent 추가: 상태 머신의 초기 상태(walk)와 같은 애니메이션으로 초기화
     entityManager.addComponent<AnimationComponent>(entityId, tcWalkAnimationData);
 
+    // AnimationStateMachineComponent 추가: 걷기/대기/점프 전환 규칙은 T.C.states.json에 있음
+    if (const AnimationStateMachine* tcStateMachine = animationManager.getStateMachine("T.C")) {
+        entityManager.addComponent<AnimationStateMachineComponent>(entityId, tcStateMachine);
+    }
+
     // SoundComponent 추가
     std::filesystem::path soundPath = std::filesystem::path(SOUND_EFFECT_ASSET_ROOT_PATH) / "hit01.flac";
     std::shared_ptr<Sound> hitSound = soundManager.getSound(soundPath);
@@ -55,19 +55,14 @@ bool InGame::loadScene() {
     // std::cerr << "[DEBUG] InGame::loadScene - Camera is successfully loaded.\n";
     
     /* --- BGM --- */
-    // auto bgmEntity = entityManager_.createEntity();
-    // sceneEntityIDs_.push_back(bgmEntity);
-    // std::filesystem::path bgmPath = static_cast<std::filesystem::path>(SOUND_ASSET_ROOT_PATH) / "TestMp3.mp3";
-    // auto bgmSound = soundManager_.getSound(bgmPath);
-    // if (bgmSound) {
-    //     auto& soundComp = entityManager_.addComponent<SoundComponent>(bgmEntity);
-    //     entityManager_.addComponent<TransformComponent>(bgmEntity);
-    //     soundComp.addSound("bgm", bgmSound, true, 0.5f);
-    //     soundComp.play("bgm");
-    // } else {
-    //     std::cerr << "[ERROR] InGame - Can't load bgm. \n";
-    // }
-    // // std::cerr << "[DEBUG] InGame::loadScene - bgm is successfully loaded.\n";
+    // 음악은 파일 전체를 풀지 않고 스트리밍으로 재생함
+    std::filesystem::path bgmPath = static_cast<std::filesystem::path>(SOUND_ASSET_ROOT_PATH) / "TestMp3.mp3";
+    bgmStream_ = soundManager_.openStream(bgmPath);
+    if (bgmStream_) {
+        bgmStream_->play(0.5f, true);
+    } else {
+        std::cerr << "[ERROR] InGame - Can't load bgm. \n";
+    }
     
     // Add components to the existing textEntity
     std::filesystem::path fontPath = static_cast<std::filesystem::path>(APP_ROOT_PATH) / "asset" / "font" / "CookieRun Regular.ttf";
@@ -117,6 +112,10 @@ void InGame::onExit() {
         entityManager_.destroyEntity(entity);
     }
     sceneEntityIDs_.clear();
+    if (bgmStream_) {
+        bgmStream_->stop();
+        bgmStream_.reset();
+    }
     isLoaded_ = false;
     std::cerr << "InGame::onExit()" << std::endl;
 }
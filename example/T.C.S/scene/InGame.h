@@ -5,6 +5,7 @@
 #include "GNEngine/core/Entity.h"
 
 #include <vector>
+#include <memory>
 
 // 필요한 Manager들의 전방 선언
 class EntityManager;
@@ -14,6 +15,7 @@ class SoundManager;
 class TextureManager;
 class TextManager;
 class AnimationManager;
+class SoundStream;
 
 
 class InGame : public Scene {
@@ -44,6 +46,7 @@ private:
     std::vector<EntityID> sceneEntityIDs_;
     EntityID playerEntity_;
     EntityID cameraEntity_;
+    std::shared_ptr<SoundStream> bgmStream_;
 };
 
 
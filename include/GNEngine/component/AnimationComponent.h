@@ -4,17 +4,37 @@
 #include <memory>
 
 #include "GNEngine/core/Component.h"
+#include "GNEngine/core/Entity.h"
 #include "GNEngine/core/Animation.h"
 
+/*
+ * @brief 애니메이션 갱신 빈도. RenderSystem이 컬링 결과로 매 프레임 정하며, 게임 코드가 직접 써도 됨.
+ *        FULL은 매 프레임, REDUCED는 AnimationSystem의 reducedUpdateInterval 프레임마다 한 번,
+ *        HIDDEN은 반복 클립이면 갱신하지 않고 시간만 쌓아 두었다가 다시 보일 때 한 번에 따라잡음.
+ */
+enum class AnimationLod : uint8_t {
+    FULL,
+    REDUCED,
+    HIDDEN,
+};
+
+/* AnimationSystem이 한 프레임 동안 모은 프레임 이벤트 하나. */
+struct AnimationEvent {
+    EntityID entity;
+    AnimationEventId event;
+};
+
 /*
  * @class AnimationComponent
  * @brief 게임 오브젝트에 애니메이션 기능을 부여하는 컴포넌트.
- * @param animation 이 컴포넌트가 재생할 Animation 데이터.
+ *        애니메이션은 AnimationTable 핸들로 들고 있으며, 현재 프레임은 클립 안의 오프셋임.
+ * @param animation 이 컴포넌트가 재생할 Animation 데이터. 생성 시 AnimationTable에 등록됨.
  * @param playOnAwake(true) 컴포넌트 생성 시 바로 애니메이션을 재생할지 여부.
  */ 
 class GNEngine_API AnimationComponent : public Component {
 public:
     AnimationComponent(std::shared_ptr<Animation> animation, bool playOnAwake = true);
+    AnimationComponent(AnimationHandle handle, bool playOnAwake = true);
 
     /*
      * @brief 컴포넌트 업데이트 로직.
@@ -44,8 +64,8 @@ public:
      */
     const SDL_Rect& getCurrentFrameRect() const;
 
-    std::shared_ptr<Animation> getAnimation() const {
-        return animation_;
+    AnimationHandle getHandle() const {
+        return handle_;
     }
 
     /*
@@ -62,7 +82,7 @@ public:
     bool isFinished() const { return isFinished_; }
 
 public:
-    std::shared_ptr<Animation> animation_;
+    AnimationHandle handle_;
     int currentFrame_;
     float frameTimer_;
     bool isPlaying_;
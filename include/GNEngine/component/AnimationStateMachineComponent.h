@@ -0,0 +1,23 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include "GNEngine/core/Component.h"
+#include "GNEngine/core/AnimationStateMachine.h"
+
+/*
+ * @class AnimationStateMachineComponent
+ * @brief 엔티티의 애니메이션을 AnimationStateMachine 정의에 따라 전환하게 하는 컴포넌트임.
+ *        SoA로 저장되며, 로직은 AnimationStateMachineSystem에서 처리함.
+ *        파라미터와 이벤트는 ComponentArray<AnimationStateMachineComponent>::setParameter / fireEvent로 씀.
+ * @param machine AnimationManager가 소유한 상태 머신 정의. 컴포넌트보다 오래 살아야 함.
+ */
+class GNEngine_API AnimationStateMachineComponent : public Component {
+public:
+    AnimationStateMachineComponent(const AnimationStateMachine* machine)
+        : machine_(machine),
+          currentState_(machine ? machine->getInitialState() : AnimationStateMachine::INVALID_STATE) {}
+
+    const AnimationStateMachine* machine_;
+    uint16_t currentState_;
+    float stateTime_ = 0.0f;
+};
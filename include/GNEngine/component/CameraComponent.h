@@ -10,15 +10,24 @@
  * @param zoom(1.0f) 카메라의 줌 레벨
  * @param x(0.0f) 카메라의 x 좌표
  * @param y(0.0f) 카메라의 y 좌표
+ * @param viewportX(0.0f), viewportY(0.0f), viewportW(1.0f), viewportH(1.0f) 화면에서 이 카메라가 그릴 영역. 렌더 출력 크기에 대한 비율(0~1)임.
+ * @param renderOrder(0) 카메라끼리 그리는 순서. 작은 값부터 그리므로 미니맵 같은 PIP 카메라는 큰 값을 줌.
 */
 struct GNEngine_API CameraComponent : public Component {
     float x;
     float y;
     float zoom;
     EntityID targetEntityId; // 카메라가 따라갈 엔티티 ID
+    float viewportX;
+    float viewportY;
+    float viewportW;
+    float viewportH;
+    int renderOrder;
 
-    CameraComponent(EntityID targetId = INVALID_ENTITY_ID, float zoom = 1.0f, float x = 0.0f, float y = 0.0f)
-        : targetEntityId(targetId), zoom(zoom), x(x), y(y) {}
+    CameraComponent(EntityID targetId = INVALID_ENTITY_ID, float zoom = 1.0f, float x = 0.0f, float y = 0.0f,
+                    float viewportX = 0.0f, float viewportY = 0.0f, float viewportW = 1.0f, float viewportH = 1.0f, int renderOrder = 0)
+        : x(x), y(y), zoom(zoom), targetEntityId(targetId),
+          viewportX(viewportX), viewportY(viewportY), viewportW(viewportW), viewportH(viewportH), renderOrder(renderOrder) {}
 };
 
 
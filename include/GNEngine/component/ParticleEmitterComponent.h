@@ -0,0 +1,78 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <SDL3/SDL.h>
+
+#include "GNEngine/core/Component.h"
+#include "GNEngine/core/RenderLayer.h"
+#include "GNEngine/core/ParticlePool.h"
+
+/*
+ * @class ParticleEmitterComponent
+ * @brief 파티클을 방출하는 이미터 컴포넌트임. TransformComponent 위치에서 방출하며,
+ *        파티클 자체는 엔티티가 아니라 이 컴포넌트가 소유한 ParticlePool(SoA)에 저장됨.
+ *        방출, 시뮬레이션, 렌더링은 ParticleSystem이 담당함.
+ * @param texture 파티클 텍스처. nullptr이면 색이 칠해진 사각형으로 그림. 소유권을 가지지 않음.
+ * @param maxParticles(1024) 이 이미터의 최대 파티클 수.
+ * @param emissionRate(100.0f) 초당 방출 개수.
+ * @param layer(RenderLayer::GAME_EFFECT) 렌더링 레이어. 레이어별 예산은 ParticleSystem에서 설정함.
+ */
+class GNEngine_API ParticleEmitterComponent : public Component {
+public:
+    ParticleEmitterComponent(SDL_Texture* texture = nullptr, size_t maxParticles = 1024, float emissionRate = 100.0f,
+                             RenderLayer layer = RenderLayer::GAME_EFFECT)
+        : emissionRate(emissionRate), texture_(texture), layer_(layer)
+    {
+        if (texture_) {
+            SDL_GetTextureSize(texture_, &textureWidth_, &textureHeight_);
+            srcRect = {0, 0, static_cast<int>(textureWidth_), static_cast<int>(textureHeight_)};
+        }
+        pool_.setCapacity(maxParticles);
+    }
+
+    /* 다음 업데이트에서 count개를 한 번에 방출함. emissionRate와 별개로 동작함. */
+    void burst(int count) { pendingBurst += count; }
+
+    SDL_Texture* getTexture() const { return texture_; }
+    float getTextureWidth() const { return textureWidth_; }
+    float getTextureHeight() const { return textureHeight_; }
+    RenderLayer getLayer() const { return layer_; }
+    void setLayer(RenderLayer layer) { layer_ = layer; }
+
+    ParticlePool& getPool() { return pool_; }
+    const ParticlePool& getPool() const { return pool_; }
+    void setMaxParticles(size_t maxParticles) { pool_.setCapacity(maxParticles); }
+
+    // --- 방출 설정 ---
+    bool isEmitting = true;
+    float emissionRate;             /* 초당 방출 개수 */
+    float offsetX = 0.0f;           /* Transform 위치 기준 방출 오프셋 */
+    float offsetY = 0.0f;
+    float direction = -90.0f;       /* 방출 방향(도). -90은 위쪽 */
+    float spread = 360.0f;          /* 방향을 중심으로 한 퍼짐 각도(도) */
+    float minSpeed = 50.0f;
+    float maxSpeed = 150.0f;
+    float minLifetime = 0.5f;       /* 초 */
+    float maxLifetime = 1.0f;
+
+    // --- 시뮬레이션 / 외형 설정 ---
+    float gravityX = 0.0f;
+    float gravityY = 0.0f;
+    float startSize = 8.0f;         /* 월드 단위 */
+    float endSize = 2.0f;
+    SDL_FColor startColor = {1.0f, 1.0f, 1.0f, 1.0f};
+    SDL_FColor endColor = {1.0f, 1.0f, 1.0f, 0.0f};
+    SDL_Rect srcRect = {0, 0, 0, 0};
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+
+    // --- ParticleSystem 내부 상태 ---
+    float emissionAccumulator = 0.0f;
+    int pendingBurst = 0;
+
+private:
+    SDL_Texture* texture_;
+    float textureWidth_ = 0.0f;
+    float textureHeight_ = 0.0f;
+    RenderLayer layer_;
+    ParticlePool pool_;
+};
@@ -79,6 +79,10 @@ public:
     bool getFlipY() const { return flipY_; }
     void setFlipY(bool flip) { flipY_ = flip; }
 
+    /* RenderSystem의 레이어 정렬 모드가 DEPTH일 때 쓰는 정렬 키. 작은 값부터 그림. */
+    float getDepth() const { return depth_; }
+    void setDepth(float depth) { depth_ = depth; }
+
 private:
     SDL_Texture* sdlTexture_;
     RenderLayer layer_;
@@ -89,6 +93,7 @@ private:
     bool hasAnimation_ = false;
     bool flipX_ = false;
     bool flipY_ = false;
+    float depth_ = 0.0f;
 };
 
 
@@ -56,6 +56,7 @@ public:
     /*
      * @brief 지정된 이름의 사운드 재생을 요청함.
      *        실제 재생은 SoundSystem이 다음 업데이트에서 처리함.
+     *        사운드가 아직 로딩 중(SoundManager::loadSoundAsync)이면 막지 않고, 준비되는 프레임에 재생됨.
      */
     void play(const std::string& name);
 
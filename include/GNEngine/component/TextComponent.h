@@ -13,14 +13,14 @@
 /*
  * @class TextComponent
  * @brief 렌더링할 텍스트에 대한 모든 정보를 담는 데이터 컴포넌트임.
- *        이 컴포넌트 자체는 로직을 가지지 않으며, RenderSystem이 이 정보를 사용해
- *        텍스처를 생성하고 화면에 렌더링함.
+ *        이 컴포넌트 자체는 로직을 가지지 않으며, TextSystem이 이 정보로 글리프 아틀라스 쿼드를 레이아웃하고
+ *        RenderSystem이 화면에 렌더링함. 텍스트 전용 텍스처는 만들지 않음.
  * @param text 렌더링할 텍스트 문자열.
  * @param fontPath 사용할 폰트 파일의 경로.
  * @param fontSize 폰트의 크기(포인트).
  * @param color 텍스트의 색상 (SDL_Color).
  * @param layer(RenderLayer::UI) 렌더링 레이어.
- * @param isDirty(true) 내용이 변경될 때 텍스처를 다시 만들어야할지 여부. 텍스처를 정상적으로 변경시 false로 바뀜.
+ * @param isDirty(true) 내용이 변경되어 다시 레이아웃해야 하는지 여부. 레이아웃이 끝나면 false로 바뀜.
  */
 struct GNEngine_API TextComponent : public Component {
     std::string text;
@@ -28,7 +28,7 @@ struct GNEngine_API TextComponent : public Component {
     int fontSize;
     SDL_Color color;
     RenderLayer layer = RenderLayer::UI;
-    bool isDirty = true; // 내용이 변경되어 텍스처를 다시 만들어야 하는지 여부
+    bool isDirty = true; // 내용이 변경되어 다시 레이아웃해야 하는지 여부
 
     TextComponent(std::string text, std::filesystem::path fontPath, int fontSize, SDL_Color color, RenderLayer layer = RenderLayer::UI)
         : text(std::move(text)), fontPath(std::move(fontPath)), fontSize(fontSize), color(color), layer(layer) {}
@@ -0,0 +1,103 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <SDL3/SDL.h>
+
+#include "GNEngine/core/Component.h"
+#include "GNEngine/core/RenderLayer.h"
+
+/*
+ * @class TilemapComponent
+ * @brief 타일 인덱스를 CHUNK_SIZE x CHUNK_SIZE 청크 단위로 저장하는 타일맵 컴포넌트임.
+ *        타일 하나를 엔티티 하나로 만들지 않고, 아틀라스 텍스처의 칸 번호만 저장함.
+ *        타일 번호 0(EMPTY_TILE)은 빈 칸이며, n은 아틀라스의 (n - 1)번째 칸(좌->우, 위->아래)을 뜻함.
+ *        렌더링은 TilemapRenderSystem이 보이는 청크만 그림.
+ * @param atlas 타일 아틀라스 텍스처. 소유권을 가지지 않음.
+ * @param widthInTiles, heightInTiles 맵의 가로/세로 타일 개수.
+ * @param tileWidth, tileHeight 타일 한 칸의 픽셀 크기. 아틀라스와 월드 단위가 같음.
+ * @param layer(RenderLayer::BACKGROUND_NEAR) 렌더링 레이어.
+ * @param originX(0.0f), originY(0.0f) 타일 (0, 0)의 좌상단 월드 좌표.
+ */
+class GNEngine_API TilemapComponent : public Component {
+public:
+    static constexpr int CHUNK_SIZE = 32;
+    static constexpr uint16_t EMPTY_TILE = 0;
+
+    /*
+     * @struct Chunk
+     * @brief 타일 인덱스와 캐시된 정점 데이터를 담는 청크.
+     *        vertices는 월드 좌표 기준이며, TilemapRenderSystem이 필요할 때 채우고 오래 안 보이면 비움.
+     */
+    struct Chunk {
+        std::array<uint16_t, CHUNK_SIZE * CHUNK_SIZE> tiles{};
+        int tileCount = 0; /* 비어 있지 않은 타일 수 */
+        std::vector<SDL_Vertex> vertices;
+        bool isGeometryDirty = true;
+        uint64_t lastDrawnFrame = 0;
+    };
+
+    TilemapComponent(SDL_Texture* atlas, int widthInTiles, int heightInTiles, int tileWidth, int tileHeight,
+                     RenderLayer layer = RenderLayer::BACKGROUND_NEAR, float originX = 0.0f, float originY = 0.0f);
+
+    void setTile(int tileX, int tileY, uint16_t tile);
+    uint16_t getTile(int tileX, int tileY) const;
+
+    /* 특정 타일 번호를 충돌 타일로 지정함. */
+    void setSolidTile(uint16_t tile, bool isSolid = true);
+    bool isSolidTile(uint16_t tile) const { return solidTiles_[tile]; }
+
+    /*
+     * @brief 월드 좌표를 타일 좌표로 변환함.
+     * @return 맵 범위 밖이면 false.
+     */
+    bool worldToTile(float worldX, float worldY, int& outTileX, int& outTileY) const;
+
+    /* 월드 좌표가 충돌 타일 위에 있는지 O(1)로 확인함. */
+    bool isSolidAt(float worldX, float worldY) const;
+
+    /* 월드 AABB가 충돌 타일과 겹치는지 확인함. 겹치는 타일 칸만 검사함. */
+    bool overlapsSolid(float minX, float minY, float maxX, float maxY) const;
+
+    SDL_Texture* getAtlas() const { return atlas_; }
+    float getAtlasWidth() const { return atlasWidth_; }
+    float getAtlasHeight() const { return atlasHeight_; }
+    int getAtlasColumns() const { return atlasColumns_; }
+    int getWidthInTiles() const { return widthInTiles_; }
+    int getHeightInTiles() const { return heightInTiles_; }
+    int getTileWidth() const { return tileWidth_; }
+    int getTileHeight() const { return tileHeight_; }
+    float getOriginX() const { return originX_; }
+    float getOriginY() const { return originY_; }
+    RenderLayer getLayer() const { return layer_; }
+    void setLayer(RenderLayer layer) { layer_ = layer; ++revision_; }
+
+    /* 타일이나 레이어가 바뀔 때마다 증가함. 화면 변경 감지용. */
+    uint64_t getRevision() const { return revision_; }
+
+    int getChunksX() const { return chunksX_; }
+    int getChunksY() const { return chunksY_; }
+    Chunk& getChunk(int chunkX, int chunkY) { return chunks_[chunkY * chunksX_ + chunkX]; }
+    std::vector<Chunk>& getChunks() { return chunks_; }
+
+private:
+    SDL_Texture* atlas_;
+    float atlasWidth_ = 0.0f;
+    float atlasHeight_ = 0.0f;
+    int atlasColumns_ = 1;
+    int widthInTiles_;
+    int heightInTiles_;
+    int tileWidth_;
+    int tileHeight_;
+    RenderLayer layer_;
+    float originX_;
+    float originY_;
+
+    int chunksX_;
+    int chunksY_;
+    std::vector<Chunk> chunks_;
+    std::vector<bool> solidTiles_; /* 타일 번호 -> 충돌 여부 */
+    uint64_t revision_ = 0;
+};
@@ -10,6 +10,7 @@
 * @param positionX(0.0f), positionY(0.0f) 위치 X, Y
 * @param scaleX(1.0f), scaleY(1.0f) 크기 배율 (너비, 높이)
 * @param rotatedAngle(0.0f) 회전된 각도
+* @param pivotX(0.5f), pivotY(0.5f) 위치와 회전의 기준점. 스프라이트 크기에 대한 비율이며 (0.5, 0.5)는 중심, (0, 0)은 좌상단임.
 */ 
 struct GNEngine_API TransformComponent : public Component {
 
@@ -18,9 +19,11 @@ struct GNEngine_API TransformComponent : public Component {
      * @param positionX, positionY 위치 X, Y
      * @param scaleX, scaleY 크기 배율 (너비, 높이)
      * @param rotatedAngle 회전된 각도
+     * @param pivotX, pivotY 위치와 회전의 기준점 (스프라이트 크기 대비 비율)
     */
-    TransformComponent(float positionX = 0.0f, float positionY = 0.0f, float scaleX = 1.0f, float scaleY = 1.0f, float rotatedAngle = 0.0f) 
-        : positionX_(positionX), positionY_(positionY), scaleX_(scaleX), scaleY_(scaleY), rotatedAngle_(rotatedAngle) {}
+    TransformComponent(float positionX = 0.0f, float positionY = 0.0f, float scaleX = 1.0f, float scaleY = 1.0f, float rotatedAngle = 0.0f,
+                       float pivotX = 0.5f, float pivotY = 0.5f) 
+        : positionX_(positionX), positionY_(positionY), scaleX_(scaleX), scaleY_(scaleY), rotatedAngle_(rotatedAngle), pivotX_(pivotX), pivotY_(pivotY) {}
 
     float positionX_;
     float positionY_;
@@ -29,8 +32,12 @@ struct GNEngine_API TransformComponent : public Component {
     float scaleX_;
     float scaleY_;
 
-    /* 0 ~ 360도(degree) 값 */
+    /* 0 ~ 360도(degree) 값. 화면 기준 시계 방향. */
     float rotatedAngle_;
+
+    /* 기준점. 스프라이트 크기에 대한 비율. */
+    float pivotX_;
+    float pivotY_;
 };                                                             
 
 
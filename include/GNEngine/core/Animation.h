@@ -6,6 +6,8 @@
 #include <filesystem>
 #include <SDL3/SDL_rect.h>
 
+#include "GNEngine/core/AnimationTable.h"
+
 /*
  * @class Animation
  * @brief 애니메이션 데이터
@@ -25,8 +27,9 @@ public:
      * @brief 애니메이션에 새 프레임을 추가함.
      * @param frameRect - 스프라이트 시트에서 해당 프레임이 차지하는 사각형 영역.
      * @param duration - 해당 프레임의 지속 시간 (밀리초 단위).
+     * @param event - 이 프레임에 들어갈 때 발생시킬 이벤트 이름. 비어 있으면 이벤트 없음.
      */
-    void addFrame(SDL_Rect frameRect, int duration);
+    void addFrame(SDL_Rect frameRect, int duration, const std::string& event = std::string());
 
     /*
      * @brief 특정 인덱스의 프레임 사각형 영역을 반환함.
@@ -42,6 +45,12 @@ public:
      */
     int getFrameDuration(int frameIndex) const;
 
+    /*
+     * @brief 특정 인덱스의 프레임 이벤트 이름을 반환함.
+     * @return 이벤트가 없거나 인덱스가 유효하지 않으면 빈 문자열.
+     */
+    const std::string& getFrameEvent(int frameIndex) const;
+
     /*
      * @brief 전체 프레임 수를 반환함.
      * @return 애니메이션의 총 프레임 수.
@@ -60,9 +69,18 @@ public:
      */
     bool isLooping() const;
 
+    /*
+     * @brief AnimationTable에서 이 애니메이션의 핸들을 반환함. 처음 호출할 때 프레임을 표에 등록함.
+     *        등록 후 addFrame을 하면 다음 호출 때 새 클립으로 다시 등록됨.
+     * @return 프레임이 없으면 INVALID_ANIMATION_HANDLE.
+     */
+    AnimationHandle getHandle() const;
+
 private:
     std::filesystem::path texturePath_;
     std::vector<SDL_Rect> frames_;
     std::vector<int> frameDurations_;
+    std::vector<std::string> frameEvents_;
     bool loop_;
+    mutable AnimationHandle handle_ = INVALID_ANIMATION_HANDLE;
 };
\ No newline at end of file
@@ -0,0 +1,118 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <SDL3/SDL_render.h>
+
+#include "GNEngine/core/AnimationTable.h"
+
+/*
+ * @class AnimationStateMachine
+ * @brief 애니메이션 상태, 전환 조건, 상태별 클립을 담는 읽기 전용 정의 데이터임.
+ *        AnimationManager::loadStateMachine이 JSON에서 만들고 소유하며, 엔티티는 AnimationStateMachineComponent로 포인터만 공유함.
+ *        엔티티별 값(현재 상태, 파라미터, 이벤트)은 컴포넌트 SoA 컬럼에 있고, 이 클래스에는 없음.
+ *        전환은 현재 상태의 목록보다 anyState 목록을 먼저 검사하며, 처음 만족하는 전환 하나만 적용함.
+ */
+class GNEngine_API AnimationStateMachine {
+public:
+    static constexpr int MAX_PARAMETERS = 8;  /* 컴포넌트 SoA 컬럼의 엔티티당 파라미터 칸 수 */
+    static constexpr int MAX_EVENTS = 32;     /* 이벤트는 uint32_t 비트 마스크로 쌓임 */
+    static constexpr uint16_t ANY_STATE = UINT16_MAX;
+    static constexpr uint16_t INVALID_STATE = UINT16_MAX;
+
+    /* 파라미터를 매 프레임 채울 컴포넌트 값. NONE이면 게임 코드가 setParameter로 직접 씀. */
+    enum class ParameterSource : uint8_t {
+        NONE,
+        SPEED,          /* |velocity| */
+        VELOCITY_X,
+        VELOCITY_Y,
+        ABS_VELOCITY_X,
+        ACCELERATION_X,
+        ACCELERATION_Y,
+    };
+
+    enum class ConditionType : uint8_t {
+        PARAMETER, /* parameters[index] comparison threshold */
+        EVENT,     /* index 번 이벤트가 이번 프레임에 발생함 */
+        FINISHED,  /* 현재 클립이 끝남(반복하지 않는 클립) */
+    };
+
+    enum class Comparison : uint8_t {
+        GREATER,
+        GREATER_EQUAL,
+        LESS,
+        LESS_EQUAL,
+    };
+
+    struct Parameter {
+        std::string name;
+        ParameterSource source = ParameterSource::NONE;
+        float defaultValue = 0.0f;
+    };
+
+    struct State {
+        std::string name;
+        AnimationHandle clip = INVALID_ANIMATION_HANDLE;
+        SDL_Texture* texture = nullptr; /* 불러올 때 TextureManager에서 찾아 둠 */
+        SDL_Rect firstFrame{};
+    };
+
+    struct Transition {
+        uint16_t target = INVALID_STATE;
+        ConditionType type = ConditionType::PARAMETER;
+        Comparison comparison = Comparison::GREATER;
+        uint8_t index = 0;          /* 파라미터 또는 이벤트 번호 */
+        float threshold = 0.0f;
+        float minStateTime = 0.0f;  /* 현재 상태에 이만큼(초) 머문 뒤에만 전환함 */
+    };
+
+    explicit AnimationStateMachine(std::string name) : name_(std::move(name)) {}
+
+    /* @return 새 파라미터 번호. MAX_PARAMETERS를 넘으면 -1. */
+    int addParameter(const std::string& name, ParameterSource source = ParameterSource::NONE, float defaultValue = 0.0f);
+    /* @return 새 이벤트 번호. MAX_EVENTS를 넘으면 -1. */
+    int addEvent(const std::string& name);
+    uint16_t addState(const std::string& name, AnimationHandle clip, SDL_Texture* texture);
+    /* from이 ANY_STATE이면 모든 상태에서 검사함. 자기 자신으로 가는 anyState 전환은 무시됨. */
+    void addTransition(uint16_t from, const Transition& transition);
+    void setInitialState(uint16_t state) { initialState_ = state; }
+
+    int findParameter(const std::string& name) const;
+    int findEvent(const std::string& name) const;
+    int findState(const std::string& name) const;
+
+    /*
+     * @brief state에서 지금 적용할 전환의 대상 상태를 찾음.
+     * @param parameters 이 엔티티의 파라미터 MAX_PARAMETERS개.
+     * @param events 이번 프레임에 발생한 이벤트 비트.
+     * @param isFinished 현재 클립이 끝났는지.
+     * @return 만족하는 전환이 없으면 state 그대로.
+     */
+    uint16_t evaluate(uint16_t state, const float* parameters, uint32_t events, float stateTime, bool isFinished) const;
+
+    /* 어느 전환이든 FINISHED 조건을 쓰는지. 쓰지 않으면 시스템이 AnimationComponent를 찾지 않음. */
+    bool usesFinished() const { return usesFinished_; }
+    /* ParameterSource가 NONE이 아닌 파라미터가 있는지. */
+    bool hasBoundParameters() const { return hasBoundParameters_; }
+
+    const std::string& getName() const { return name_; }
+    uint16_t getInitialState() const { return initialState_; }
+    const State& getState(uint16_t state) const { return states_[state]; }
+    size_t getStateCount() const { return states_.size(); }
+    const std::vector<Parameter>& getParameters() const { return parameters_; }
+
+private:
+    bool matches(const Transition& transition, const float* parameters, uint32_t events, float stateTime, bool isFinished) const;
+
+    std::string name_;
+    std::vector<Parameter> parameters_;
+    std::vector<std::string> events_;
+    std::vector<State> states_;
+    std::vector<std::vector<Transition>> stateTransitions_; /* states_와 같은 순서 */
+    std::vector<Transition> anyStateTransitions_;
+    uint16_t initialState_ = 0;
+    bool usesFinished_ = false;
+    bool hasBoundParameters_ = false;
+};
@@ -0,0 +1,78 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL_rect.h>
+
+class Animation;
+
+/* AnimationTable의 클립 번호. 엔티티는 shared_ptr<Animation> 대신 이 번호와 프레임 오프셋으로 애니메이션을 참조함. */
+using AnimationHandle = uint32_t;
+constexpr AnimationHandle INVALID_ANIMATION_HANDLE = UINT32_MAX;
+
+/* 프레임 이벤트(발소리, 타격 프레임 등) 이름을 전역으로 번호 매긴 값. 같은 이름은 어느 클립에서나 같은 번호임. */
+using AnimationEventId = uint32_t;
+constexpr AnimationEventId NO_ANIMATION_EVENT = UINT32_MAX;
+
+/*
+ * @class AnimationTable
+ * @brief 불러온 모든 애니메이션의 프레임을 하나의 연속된 표로 펼쳐 둔 전역 테이블임.
+ *        클립 하나는 표의 [firstFrame, firstFrame + frameCount) 구간이며, 프레임 지속 시간은 초 단위로 미리 변환해 둠.
+ *        AnimationSystem은 포인터를 따라가지 않고 이 표와 컴포넌트의 SoA 컬럼만 읽음.
+ *        프레임마다 그 프레임에 들어갈 때 발생하는 이벤트 번호를 프레임 표와 나란히 둠.
+ *        항목은 추가만 되고 지워지지 않으므로 핸들과 프레임 인덱스는 프로그램이 끝날 때까지 유효함.
+ *        등록은 메인 스레드에서만 해야 함.
+ */
+class GNEngine_API AnimationTable {
+public:
+    struct Clip {
+        uint32_t firstFrame;
+        uint32_t frameCount;
+        float totalDuration; /* 초 */
+        bool isLooping;
+        bool hasEvents;      /* 이벤트가 달린 프레임이 하나라도 있는지 */
+    };
+
+    static AnimationTable& instance();
+
+    /*
+     * @brief animation의 프레임을 표 끝에 복사하고 핸들을 돌려줌. 보통 Animation::getHandle을 통해 한 번만 호출됨.
+     * @return 프레임이 없으면 INVALID_ANIMATION_HANDLE.
+     */
+    AnimationHandle registerAnimation(const Animation& animation);
+
+    bool isValid(AnimationHandle handle) const { return handle < clips_.size(); }
+    const Clip& getClip(AnimationHandle handle) const { return clips_[handle]; }
+    const std::filesystem::path& getTexturePath(AnimationHandle handle) const { return texturePaths_[handle]; }
+    size_t getClipCount() const { return clips_.size(); }
+
+    /* 표 전체 인덱스(Clip::firstFrame + 오프셋)로 읽음. */
+    const SDL_Rect& getFrameRect(uint32_t frame) const { return frameRects_[frame]; }
+    float getFrameDuration(uint32_t frame) const { return frameDurations_[frame]; }
+    const std::vector<SDL_Rect>& getFrameRects() const { return frameRects_; }
+    const std::vector<float>& getFrameDurations() const { return frameDurations_; }
+    AnimationEventId getFrameEvent(uint32_t frame) const { return frameEvents_[frame]; }
+    const std::vector<AnimationEventId>& getFrameEvents() const { return frameEvents_; }
+
+    /* 이벤트 이름의 번호를 돌려줌. 처음 보는 이름이면 새 번호를 매김. 빈 이름은 NO_ANIMATION_EVENT. */
+    AnimationEventId registerEvent(const std::string& name);
+    /* @return 등록되지 않은 이름이면 NO_ANIMATION_EVENT. */
+    AnimationEventId findEvent(const std::string& name) const;
+    const std::string& getEventName(AnimationEventId event) const { return eventNames_[event]; }
+    size_t getEventCount() const { return eventNames_.size(); }
+
+private:
+    AnimationTable() = default;
+
+    std::vector<SDL_Rect> frameRects_;
+    std::vector<float> frameDurations_;
+    std::vector<AnimationEventId> frameEvents_; /* 이벤트가 없는 프레임은 NO_ANIMATION_EVENT */
+    std::vector<Clip> clips_;
+    std::vector<std::filesystem::path> texturePaths_; /* 클립 전환 때만 쓰는 차가운 데이터 */
+    std::vector<std::string> eventNames_;
+    std::unordered_map<std::string, AnimationEventId> eventIds_;
+};
@@ -1,6 +1,8 @@
 ﻿#pragma once
 
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <memory>
 #include <stdexcept>
@@ -13,8 +15,10 @@
 #include "GNEngine/component/AccelerationComponent.h"
 #include "GNEngine/component/RenderComponent.h"
 #include "GNEngine/component/AnimationComponent.h"
+#include "GNEngine/component/AnimationStateMachineComponent.h"
 #include "GNEngine/component/TextComponent.h"
 #include "GNEngine/component/CameraComponent.h"
+#include "GNEngine/core/GlyphAtlas.h"
 
 class IComponentArray {
 public:
@@ -88,6 +92,10 @@ public:
         return entityToIndexMap;
     }
 
+    EntityID getEntity(size_t index) const {
+        return indexToEntityMap.at(index);
+    }
+
 protected:
     virtual void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) = 0;
 
@@ -116,6 +124,8 @@ public:
             scaleX.resize(index + 1);
             scaleY.resize(index + 1);
             rotatedAngle.resize(index + 1);
+            pivotX.resize(index + 1);
+            pivotY.resize(index + 1);
         }
 
         positionX[index] = component.positionX_;
@@ -123,6 +133,8 @@ public:
         scaleX[index] = component.scaleX_;
         scaleY[index] = component.scaleY_;
         rotatedAngle[index] = component.rotatedAngle_;
+        pivotX[index] = component.pivotX_;
+        pivotY[index] = component.pivotY_;
     }
 
     void removeComponent(EntityID entity) { /* Stub */ }
@@ -137,7 +149,9 @@ public:
             positionY[index],
             scaleX[index],
             scaleY[index],
-            rotatedAngle[index]
+            rotatedAngle[index],
+            pivotX[index],
+            pivotY[index]
         };
     }
 
@@ -146,6 +160,8 @@ public:
     std::vector<float> scaleX;
     std::vector<float> scaleY;
     std::vector<float> rotatedAngle;
+    std::vector<float> pivotX;
+    std::vector<float> pivotY;
 
 protected:
     void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) override {
@@ -154,12 +170,16 @@ protected:
         scaleX[indexOfRemoved] = scaleX[indexOfLast];
         scaleY[indexOfRemoved] = scaleY[indexOfLast];
         rotatedAngle[indexOfRemoved] = rotatedAngle[indexOfLast];
+        pivotX[indexOfRemoved] = pivotX[indexOfLast];
+        pivotY[indexOfRemoved] = pivotY[indexOfLast];
 
         positionX.pop_back();
         positionY.pop_back();
         scaleX.pop_back();
         scaleY.pop_back();
         rotatedAngle.pop_back();
+        pivotX.pop_back();
+        pivotY.pop_back();
     }
 };
 
@@ -279,6 +299,7 @@ public:
             srcRectH.resize(index + 1);
             flipX.resize(index + 1);
             flipY.resize(index + 1);
+            depths.resize(index + 1);
         }
 
         sdlTextures[index] = component.getSDLTexture();
@@ -294,6 +315,7 @@ public:
         srcRectH[index] = rect.h;
         flipX[index] = component.getFlipX();
         flipY[index] = component.getFlipY();
+        depths[index] = component.getDepth();
     }
 
     void removeComponent(EntityID entity) { /* Stub */ }
@@ -303,7 +325,17 @@ public:
             throw std::runtime_error("RenderComponent not found for entity.");
         }
         size_t i = entityToIndexMap.at(entity);
-        return RenderComponent(sdlTextures[i], layers[i], isScreenSpace[i], hasAnimations[i], widths[i], heights[i], {srcRectX[i], srcRectY[i], srcRectW[i], srcRectH[i]}, flipX[i], flipY[i]);
+        RenderComponent component(sdlTextures[i], layers[i], isScreenSpace[i], hasAnimations[i], widths[i], heights[i], {srcRectX[i], srcRectY[i], srcRectW[i], srcRectH[i]}, flipX[i], flipY[i]);
+        component.setDepth(depths[i]);
+        return component;
+    }
+
+    /* 레이어 정렬 모드가 DEPTH일 때 쓰는 정렬 키를 바꿈. */
+    void setDepth(EntityID entity, float depth) {
+        auto it = entityToIndexMap.find(entity);
+        if (it != entityToIndexMap.end()) {
+            depths[it->second] = depth;
+        }
     }
 
     void updateTexture(EntityID entity, SDL_Texture* texture, int width, int height) {
@@ -334,6 +366,7 @@ public:
     std::vector<int> srcRectX, srcRectY, srcRectW, srcRectH;
     std::vector<bool> flipX, flipY;
     std::vector<bool> isScreenSpace;
+    std::vector<float> depths; /* 사용자 정의 정렬 키. 작은 값부터 그림 */
 
 protected:
     void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) override {
@@ -352,6 +385,7 @@ protected:
         srcRectH[indexOfRemoved] = srcRectH[indexOfLast];
         flipX[indexOfRemoved] = flipX[indexOfLast];
         flipY[indexOfRemoved] = flipY[indexOfLast];
+        depths[indexOfRemoved] = depths[indexOfLast];
 
         sdlTextures.pop_back();
         layers.pop_back();
@@ -365,6 +399,7 @@ protected:
         srcRectH.pop_back();
         flipX.pop_back();
         flipY.pop_back();
+        depths.pop_back();
     }
 };
 
@@ -382,19 +417,98 @@ public:
             index = it->second;
         }
 
-        if (index >= animations.size()) {
-            animations.resize(index + 1);
+        if (index >= handles.size()) {
+            handles.resize(index + 1);
+            firstFrames.resize(index + 1);
+            frameCounts.resize(index + 1);
+            areLooping.resize(index + 1);
             currentFrames.resize(index + 1);
             frameTimers.resize(index + 1);
             arePlaying.resize(index + 1);
             areFinished.resize(index + 1);
+            lodLevels.resize(index + 1);
+            pendingTimes.resize(index + 1);
+            hasEvents.resize(index + 1);
         }
 
-        animations[index] = component.animation_;
+        setAnimation(index, component.handle_);
         currentFrames[index] = component.currentFrame_;
         frameTimers[index] = component.frameTimer_;
         arePlaying[index] = component.isPlaying_;
         areFinished[index] = component.isFinished_;
+        lodLevels[index] = AnimationLod::FULL;
+    }
+
+    /* index의 클립을 바꾸고 AnimationTable에서 클립 정보를 캐시함. 이전 클립에 쌓인 시간은 버리고, 재생 상태는 건드리지 않음. */
+    void setAnimation(size_t index, AnimationHandle handle) {
+        const AnimationTable& table = AnimationTable::instance();
+        handles[index] = handle;
+        pendingTimes[index] = 0.0f;
+        if (table.isValid(handle)) {
+            const AnimationTable::Clip& clip = table.getClip(handle);
+            firstFrames[index] = clip.firstFrame;
+            frameCounts[index] = clip.frameCount;
+            areLooping[index] = clip.isLooping;
+            hasEvents[index] = clip.hasEvents;
+        } else {
+            firstFrames[index] = 0;
+            frameCounts[index] = 0;
+            areLooping[index] = false;
+            hasEvents[index] = false;
+        }
+    }
+
+    /*
+     * @brief index의 애니메이션을 elapsed초만큼 진행함. 반복 클립은 전체 길이로 나눈 나머지만 걸으므로
+     *        오래 숨어 있던 엔티티도 클립 길이에 비례하는 비용으로 매 프레임 진행한 것과 같은 프레임에 도착함.
+     * @param outEvents(nullptr) 주어지면 들어간 프레임의 이벤트를 모두 순서대로 덧붙임.
+     *        이때 이벤트가 있는 클립은 바퀴를 건너뛰지 않고 프레임마다 걸으므로 이벤트를 잃지 않음.
+     */
+    void advance(size_t index, float elapsed, std::vector<AnimationEvent>* outEvents = nullptr) {
+        const AnimationTable& table = AnimationTable::instance();
+        const float* durations = table.getFrameDurations().data() + firstFrames[index];
+        const int frameCount = static_cast<int>(frameCounts[index]);
+        int frame = currentFrames[index];
+        float timer = frameTimers[index] + elapsed;
+        if (timer < durations[frame]) {
+            frameTimers[index] = timer;
+            return;
+        }
+
+        const AnimationEventId* frameEvents = (outEvents && hasEvents[index]) ? table.getFrameEvents().data() + firstFrames[index] : nullptr;
+        if (areLooping[index]) {
+            const float totalDuration = table.getClip(handles[index]).totalDuration;
+            if (totalDuration <= 0.0f) {
+                return;
+            }
+            if (timer >= totalDuration && !frameEvents) {
+                // 클립 처음부터의 시간으로 바꾼 뒤 한 바퀴 길이로 나눈 나머지만 남김
+                for (int f = 0; f < frame; ++f) {
+                    timer += durations[f];
+                }
+                timer = std::fmod(timer, totalDuration);
+                frame = 0;
+            }
+        }
+
+        while (timer >= durations[frame]) {
+            timer -= durations[frame];
+            if (++frame >= frameCount) {
+                if (!areLooping[index]) {
+                    currentFrames[index] = frameCount - 1;
+                    frameTimers[index] = timer;
+                    arePlaying[index] = false;
+                    areFinished[index] = true;
+                    return;
+                }
+                frame = 0;
+            }
+            if (frameEvents && frameEvents[frame] != NO_ANIMATION_EVENT) {
+                outEvents->push_back({getEntity(index), frameEvents[frame]});
+            }
+        }
+        currentFrames[index] = frame;
+        frameTimers[index] = timer;
     }
 
     void removeComponent(EntityID entity) { /* Stub */ }
@@ -404,7 +518,7 @@ public:
             throw std::runtime_error("AnimationComponent not found for entity.");
         }
         size_t i = entityToIndexMap.at(entity);
-        AnimationComponent comp(animations[i]);
+        AnimationComponent comp(handles[i]);
         comp.currentFrame_ = currentFrames[i];
         comp.frameTimer_ = frameTimers[i];
         comp.isPlaying_ = arePlaying[i];
@@ -412,25 +526,139 @@ public:
         return comp;
     }
 
-    std::vector<std::shared_ptr<Animation>> animations;
-    std::vector<int> currentFrames;
+    /* 클립 정보(handles ~ areLooping)는 AnimationTable에서 복사해 둔 값이라 업데이트 루프가 표의 Clip을 읽지 않아도 됨. */
+    std::vector<AnimationHandle> handles;
+    std::vector<uint32_t> firstFrames;   /* AnimationTable 프레임 표에서 클립의 시작 인덱스 */
+    std::vector<uint32_t> frameCounts;   /* 0이면 재생할 프레임이 없음 */
+    std::vector<uint8_t> areLooping;
+    std::vector<int> currentFrames;      /* 클립 안의 오프셋 */
     std::vector<float> frameTimers;
-    std::vector<bool> arePlaying;
-    std::vector<bool> areFinished;
+    std::vector<uint8_t> arePlaying;
+    std::vector<uint8_t> areFinished;
+    std::vector<AnimationLod> lodLevels;
+    std::vector<float> pendingTimes;     /* 갱신을 건너뛰는 동안 쌓인 시간(초). 다음 갱신이나 다시 보일 때 advance로 소모함 */
+    std::vector<uint8_t> hasEvents;      /* 클립에 프레임 이벤트가 있는지 */
 
 protected:
     void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) override {
-        animations[indexOfRemoved] = std::move(animations[indexOfLast]);
+        handles[indexOfRemoved] = handles[indexOfLast];
+        firstFrames[indexOfRemoved] = firstFrames[indexOfLast];
+        frameCounts[indexOfRemoved] = frameCounts[indexOfLast];
+        areLooping[indexOfRemoved] = areLooping[indexOfLast];
         currentFrames[indexOfRemoved] = currentFrames[indexOfLast];
         frameTimers[indexOfRemoved] = frameTimers[indexOfLast];
         arePlaying[indexOfRemoved] = arePlaying[indexOfLast];
         areFinished[indexOfRemoved] = areFinished[indexOfLast];
-
-        animations.pop_back();
+        lodLevels[indexOfRemoved] = lodLevels[indexOfLast];
+        pendingTimes[indexOfRemoved] = pendingTimes[indexOfLast];
+        hasEvents[indexOfRemoved] = hasEvents[indexOfLast];
+
+        handles.pop_back();
+        firstFrames.pop_back();
+        frameCounts.pop_back();
+        areLooping.pop_back();
         currentFrames.pop_back();
         frameTimers.pop_back();
         arePlaying.pop_back();
         areFinished.pop_back();
+        lodLevels.pop_back();
+        pendingTimes.pop_back();
+        hasEvents.pop_back();
+    }
+};
+
+template<>
+class ComponentArray<AnimationStateMachineComponent> : public SoAComponentArray {
+public:
+    static constexpr int PARAMETER_STRIDE = AnimationStateMachine::MAX_PARAMETERS;
+
+    void addComponent(EntityID entity, AnimationStateMachineComponent&& component) {
+        size_t index;
+        auto it = entityToIndexMap.find(entity);
+        if (it == entityToIndexMap.end()) {
+            index = indexToEntityMap.size();
+            entityToIndexMap[entity] = index;
+            indexToEntityMap[index] = entity;
+        } else {
+            index = it->second;
+        }
+
+        if (index >= machines.size()) {
+            machines.resize(index + 1);
+            currentStates.resize(index + 1);
+            stateTimes.resize(index + 1);
+            parameters.resize((index + 1) * PARAMETER_STRIDE);
+            events.resize(index + 1);
+            areApplied.resize(index + 1);
+        }
+
+        machines[index] = component.machine_;
+        currentStates[index] = component.currentState_;
+        stateTimes[index] = component.stateTime_;
+        events[index] = 0;
+        areApplied[index] = false; // 첫 업데이트에서 현재 상태의 클립을 적용함
+
+        float* values = &parameters[index * PARAMETER_STRIDE];
+        std::fill(values, values + PARAMETER_STRIDE, 0.0f);
+        if (component.machine_) {
+            const auto& definitions = component.machine_->getParameters();
+            for (size_t p = 0; p < definitions.size(); ++p) {
+                values[p] = definitions[p].defaultValue;
+            }
+        }
+    }
+
+    /* 게임 코드가 쓰는 파라미터 값. 바인딩된 파라미터(ParameterSource)는 시스템이 매 프레임 덮어씀. */
+    void setParameter(EntityID entity, int parameter, float value) {
+        auto it = entityToIndexMap.find(entity);
+        if (it != entityToIndexMap.end() && parameter >= 0 && parameter < PARAMETER_STRIDE) {
+            parameters[it->second * PARAMETER_STRIDE + parameter] = value;
+        }
+    }
+
+    /* 이벤트는 다음 AnimationStateMachineSystem::update에서 한 번 검사된 뒤 지워짐. */
+    void fireEvent(EntityID entity, int event) {
+        auto it = entityToIndexMap.find(entity);
+        if (it != entityToIndexMap.end() && event >= 0 && event < AnimationStateMachine::MAX_EVENTS) {
+            events[it->second] |= 1u << event;
+        }
+    }
+
+    void removeComponent(EntityID entity) { /* Stub */ }
+
+    AnimationStateMachineComponent getComponent(EntityID entity) {
+        if (!entityToIndexMap.count(entity)) {
+            throw std::runtime_error("AnimationStateMachineComponent not found for entity.");
+        }
+        size_t i = entityToIndexMap.at(entity);
+        AnimationStateMachineComponent comp(machines[i]);
+        comp.currentState_ = currentStates[i];
+        comp.stateTime_ = stateTimes[i];
+        return comp;
+    }
+
+    std::vector<const AnimationStateMachine*> machines;
+    std::vector<uint16_t> currentStates;
+    std::vector<float> stateTimes;   /* 현재 상태에 머문 시간(초) */
+    std::vector<float> parameters;   /* 엔티티당 PARAMETER_STRIDE칸 */
+    std::vector<uint32_t> events;    /* 이번 프레임에 발생한 이벤트 비트 */
+    std::vector<uint8_t> areApplied; /* false면 현재 상태의 클립을 아직 AnimationComponent/RenderComponent에 적용하지 않음 */
+
+protected:
+    void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) override {
+        machines[indexOfRemoved] = machines[indexOfLast];
+        currentStates[indexOfRemoved] = currentStates[indexOfLast];
+        stateTimes[indexOfRemoved] = stateTimes[indexOfLast];
+        std::copy_n(&parameters[indexOfLast * PARAMETER_STRIDE], PARAMETER_STRIDE, &parameters[indexOfRemoved * PARAMETER_STRIDE]);
+        events[indexOfRemoved] = events[indexOfLast];
+        areApplied[indexOfRemoved] = areApplied[indexOfLast];
+
+        machines.pop_back();
+        currentStates.pop_back();
+        stateTimes.pop_back();
+        parameters.resize(parameters.size() - PARAMETER_STRIDE);
+        events.pop_back();
+        areApplied.pop_back();
     }
 };
 
@@ -458,6 +686,7 @@ public:
             colorsA.resize(index + 1);
             areDirty.resize(index + 1);
             layers.resize(index + 1);
+            layouts.resize(index + 1);
         }
 
         texts[index] = std::move(component.text);
@@ -491,16 +720,31 @@ public:
         areDirty[i] = isDirty;
     }
 
+    /* 텍스트를 바꾸고 내용이 달라졌을 때만 dirty로 표시함. */
+    void setText(EntityID entity, const std::string& text) {
+        auto it = entityToIndexMap.find(entity);
+        if (it == entityToIndexMap.end()) {
+            return;
+        }
+        size_t i = it->second;
+        if (texts[i] != text) {
+            texts[i] = text;
+            areDirty[i] = true;
+        }
+    }
+
     std::vector<std::string> texts;
     std::vector<std::filesystem::path> fontPaths;
     std::vector<int> fontSizes;
     std::vector<Uint8> colorsR, colorsG, colorsB, colorsA;
     std::vector<bool> areDirty;
     std::vector<RenderLayer> layers;
+    std::vector<TextLayout> layouts; /* TextSystem이 만든 글리프 쿼드. RenderSystem이 그림. */
 
 protected:
     void swapAndPop(size_t i, size_t last_i) override {
         texts[i] = std::move(texts[last_i]);
+        layouts[i] = std::move(layouts[last_i]);
         fontPaths[i] = std::move(fontPaths[last_i]);
         fontSizes[i] = fontSizes[last_i];
         colorsR[i] = colorsR[last_i];
@@ -519,6 +763,7 @@ protected:
         colorsA.pop_back();
         areDirty.pop_back();
         layers.pop_back();
+        layouts.pop_back();
     }
 };
 
@@ -541,12 +786,22 @@ public:
             y.resize(index + 1);
             zoom.resize(index + 1);
             targetEntityIds.resize(index + 1);
+            viewportX.resize(index + 1);
+            viewportY.resize(index + 1);
+            viewportW.resize(index + 1);
+            viewportH.resize(index + 1);
+            renderOrders.resize(index + 1);
         }
 
         x[index] = component.x;
         y[index] = component.y;
         zoom[index] = component.zoom;
         targetEntityIds[index] = component.targetEntityId;
+        viewportX[index] = component.viewportX;
+        viewportY[index] = component.viewportY;
+        viewportW[index] = component.viewportW;
+        viewportH[index] = component.viewportH;
+        renderOrders[index] = component.renderOrder;
     }
 
     void removeComponent(EntityID entity) { /* Stub */ }
@@ -556,13 +811,18 @@ public:
             throw std::runtime_error("CameraComponent not found for entity.");
         }
         size_t i = entityToIndexMap.at(entity);
-        return CameraComponent(x[i], y[i], zoom[i], targetEntityIds[i]);
+        return CameraComponent(targetEntityIds[i], zoom[i], x[i], y[i], viewportX[i], viewportY[i], viewportW[i], viewportH[i], renderOrders[i]);
     }
 
     std::vector<float> x;
     std::vector<float> y;
     std::vector<float> zoom;
     std::vector<EntityID> targetEntityIds;
+    std::vector<float> viewportX; /* 렌더 출력 대비 비율 */
+    std::vector<float> viewportY;
+    std::vector<float> viewportW;
+    std::vector<float> viewportH;
+    std::vector<int> renderOrders;
 
 protected:
     void swapAndPop(size_t indexOfRemoved, size_t indexOfLast) override {
@@ -570,10 +830,20 @@ protected:
         y[indexOfRemoved] = y[indexOfLast];
         zoom[indexOfRemoved] = zoom[indexOfLast];
         targetEntityIds[indexOfRemoved] = targetEntityIds[indexOfLast];
+        viewportX[indexOfRemoved] = viewportX[indexOfLast];
+        viewportY[indexOfRemoved] = viewportY[indexOfLast];
+        viewportW[indexOfRemoved] = viewportW[indexOfLast];
+        viewportH[indexOfRemoved] = viewportH[indexOfLast];
+        renderOrders[indexOfRemoved] = renderOrders[indexOfLast];
 
         x.pop_back();
         y.pop_back();
         zoom.pop_back();
         targetEntityIds.pop_back();
+        viewportX.pop_back();
+        viewportY.pop_back();
+        viewportW.pop_back();
+        viewportH.pop_back();
+        renderOrders.pop_back();
     }
 };
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstddef>
+
+/*
+ * @class FastMath
+ * @brief 렌더링처럼 정밀도보다 처리량이 중요한 곳에서 쓰는 근사 수학 함수 모음임.
+ *        sin/cos는 [-pi/4, pi/4]로 범위를 줄인 뒤 다항식으로 근사하며, 최대 오차는 약 2e-6임(±1000도 기준).
+ */
+class GNEngine_API FastMath {
+public:
+    /*
+     * @brief 각도 배열의 sin/cos를 한 번에 계산함. SSE2를 쓸 수 있으면 4개씩 처리함.
+     * @param degrees 도(degree) 단위 각도 배열.
+     * @param outSin, outCos 결과 배열. degrees와 같은 길이여야 함.
+     * @param count 원소 수.
+     */
+    static void sinCosDegrees(const float* degrees, float* outSin, float* outCos, size_t count);
+
+    /* 각도 하나의 sin/cos. 배열 버전과 같은 근사식을 사용함. */
+    static void sinCosDegrees(float degrees, float& outSin, float& outCos);
+};
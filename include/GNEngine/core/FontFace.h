@@ -0,0 +1,46 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <filesystem>
+#include <SDL3_ttf/SDL_ttf.h>
+
+/*
+ * @brief 메모리에 올린 폰트 파일 내용. 같은 파일의 여러 FontFace(크기/스타일별)가 공유함.
+ */
+struct FontFileData {
+    std::filesystem::path path;
+    std::vector<uint8_t> bytes;
+};
+
+/*
+ * @class FontFace
+ * @brief (폰트 파일, 포인트 크기, 스타일) 하나에 대응하는 TTF_Font 래퍼임.
+ *        TTF_OpenFontIO로 공유된 FontFileData에서 열기 때문에 크기가 달라도 파일은 한 번만 읽음.
+ *        크기와 스타일은 생성 후 바뀌지 않으므로 SDL_ttf의 글리프 캐시가 무효화되지 않음.
+ * @param fileData 폰트 파일 내용. FontFace가 살아있는 동안 함께 유지됨.
+ * @param pointSize 포인트 크기.
+ * @param style(TTF_STYLE_NORMAL) TTF_STYLE_* 플래그.
+ */
+class GNEngine_API FontFace {
+public:
+    FontFace(std::shared_ptr<const FontFileData> fileData, int pointSize, int style = TTF_STYLE_NORMAL);
+    ~FontFace();
+
+    FontFace(const FontFace&) = delete;
+    FontFace& operator=(const FontFace&) = delete;
+
+    bool isValid() const { return font_ != nullptr; }
+    TTF_Font* getFont() const { return font_; }
+    int getPointSize() const { return pointSize_; }
+    int getStyle() const { return style_; }
+    const std::filesystem::path& getPath() const { return fileData_->path; }
+
+private:
+    std::shared_ptr<const FontFileData> fileData_;
+    TTF_Font* font_ = nullptr;
+    int pointSize_;
+    int style_;
+};
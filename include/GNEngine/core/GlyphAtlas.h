@@ -0,0 +1,94 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <cstdint>
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+class GlyphAtlas;
+
+/* 레이아웃된 글리프 쿼드 하나. x, y는 텍스트 좌상단 기준 픽셀 좌표. */
+struct GlyphQuad {
+    SDL_FRect srcRect;
+    float x, y, w, h;
+};
+
+/*
+ * @struct TextLayout
+ * @brief 문자열 하나를 글리프 쿼드로 펼친 결과. 아틀라스 텍스처의 영역만 가리키므로 텍스처를 만들지 않음.
+ */
+struct TextLayout {
+    GlyphAtlas* atlas = nullptr;
+    std::vector<GlyphQuad> quads;
+    float width = 0.0f;
+    float height = 0.0f;
+};
+
+/*
+ * @class GlyphAtlas
+ * @brief 폰트 하나(폰트 파일 + 크기)의 글리프를 한 텍스처에 모아 두는 캐시임.
+ *        글리프는 처음 쓰일 때 한 번만 흰색으로 래스터라이즈해서 선반(shelf) 방식으로 배치하고,
+ *        색은 정점 색으로 입힘. 메트릭과 커닝도 함께 캐시함.
+ *        CPU 쪽 사본을 들고 있어 아틀라스가 가득 차면 더 큰 텍스처로 키워 다시 올림. 기존 글리프 좌표는 바뀌지 않음.
+ * @param renderer 아틀라스 텍스처를 만들 SDL_Renderer.
+ * @param font 글리프를 래스터라이즈할 폰트. 소유권을 가지지 않음.
+ */
+class GNEngine_API GlyphAtlas {
+public:
+    static constexpr int ATLAS_WIDTH = 512;
+    static constexpr int INITIAL_ATLAS_HEIGHT = 128;
+    static constexpr int MAX_ATLAS_HEIGHT = 4096;
+
+    struct Glyph {
+        SDL_Rect rect;   /* 아틀라스 안의 영역. 공백 등 그릴 것이 없으면 w, h가 0 */
+        int advance;
+    };
+
+    GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font);
+    ~GlyphAtlas();
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /*
+     * @brief 글리프 정보를 반환함. 캐시에 없으면 래스터라이즈해서 아틀라스에 추가함.
+     * @return 폰트에 없는 글리프이거나 아틀라스를 더 키울 수 없으면 nullptr.
+     */
+    const Glyph* getGlyph(uint32_t codepoint);
+
+    /* 두 글리프 사이의 커닝(픽셀). 결과를 캐시함. */
+    int getKerning(uint32_t previous, uint32_t codepoint);
+
+    /*
+     * @brief UTF-8 문자열을 글리프 쿼드로 펼침. '\n'에서 줄을 바꿈.
+     *        out의 기존 버퍼를 재사용하므로 같은 엔티티의 텍스트가 바뀌어도 할당이 거의 없음.
+     */
+    void layoutText(const std::string& text, TextLayout& out);
+
+    SDL_Texture* getTexture() const { return texture_; }
+    TTF_Font* getFont() const { return font_; }
+    int getLineSkip() const { return lineSkip_; }
+    int getFontHeight() const { return fontHeight_; }
+
+private:
+    bool allocate(int w, int h, SDL_Rect& outRect);
+    bool grow();
+
+    SDL_Renderer* renderer_;
+    TTF_Font* font_;
+    SDL_Surface* pixels_ = nullptr; /* 아틀라스의 CPU 사본 */
+    SDL_Texture* texture_ = nullptr;
+    int lineSkip_ = 0;
+    int fontHeight_ = 0;
+
+    /* 선반 배치 상태 */
+    int shelfX_ = 0;
+    int shelfY_ = 0;
+    int shelfHeight_ = 0;
+
+    std::unordered_map<uint32_t, Glyph> glyphs_;
+    std::unordered_map<uint64_t, int> kerning_;
+};
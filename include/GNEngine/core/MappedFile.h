@@ -0,0 +1,38 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+/*
+ * @class MappedFile
+ * @brief 파일을 읽기 전용으로 메모리에 매핑함. 내용을 버퍼로 복사하지 않고 바로 읽을 수 있어 FlatBuffers 파일을 불러올 때 씀.
+ *        매핑은 close하거나 객체가 사라질 때까지 유효함.
+ */
+class GNEngine_API MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /* @return 파일을 열지 못했거나 비어 있으면 false. */
+    bool open(const std::filesystem::path& path);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const uint8_t* getData() const { return data_; }
+    size_t getSize() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    void* fileHandle_ = nullptr;
+    void* mappingHandle_ = nullptr;
+#else
+    int fileDescriptor_ = -1;
+#endif
+};
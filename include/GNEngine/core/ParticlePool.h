@@ -0,0 +1,65 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <vector>
+#include <cstddef>
+
+/*
+ * @struct ParticleUpdateParams
+ * @brief ParticlePool::simulate에 넘기는 프레임 공통 값.
+ *        크기와 색은 남은 수명 비율 t(1 -> 0)에 따라 start -> end로 보간함.
+ */
+struct ParticleUpdateParams {
+    float deltaTime = 0.0f;
+    float gravityX = 0.0f;
+    float gravityY = 0.0f;
+    float startSize = 1.0f;
+    float endSize = 1.0f;
+    float startColor[4] = {1.0f, 1.0f, 1.0f, 1.0f}; /* RGBA, 0 ~ 1 */
+    float endColor[4] = {1.0f, 1.0f, 1.0f, 0.0f};
+};
+
+/*
+ * @class ParticlePool
+ * @brief 이미터 하나가 소유하는 파티클 SoA 풀임. ECS 밖에 있으며 엔티티를 만들지 않음.
+ *        살아있는 파티클은 항상 [0, size()) 구간에 빽빽하게 모여 있음.
+ *        용량은 4의 배수로 올려 잡아 SIMD 커널이 꼬리 처리 없이 4개씩 읽고 쓸 수 있게 함.
+ */
+class GNEngine_API ParticlePool {
+public:
+    ParticlePool() = default;
+
+    /* 최대 파티클 수를 정함. 기존 파티클은 버림. */
+    void setCapacity(size_t capacity);
+    size_t capacity() const { return capacity_; }
+    size_t size() const { return count_; }
+    size_t freeSlots() const { return capacity_ - count_; }
+    void clear() { count_ = 0; }
+
+    /*
+     * @brief 파티클 하나를 추가함.
+     * @param lifetime 수명(초). 0 이하이면 추가하지 않음.
+     * @return 풀이 가득 찼으면 false.
+     */
+    bool spawn(float x, float y, float vx, float vy, float lifetime);
+
+    /*
+     * @brief 모든 파티클의 속도, 위치, 수명, 크기, 색을 갱신하고 죽은 파티클을 제거함.
+     *        SSE2를 쓸 수 있으면 4개씩 처리하고, 아니면 스칼라 루프로 처리함.
+     */
+    void simulate(const ParticleUpdateParams& params);
+
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> life;        /* 남은 수명(초) */
+    std::vector<float> invLifetime; /* 1 / 전체 수명 */
+    std::vector<float> sizes;
+    std::vector<float> colorR, colorG, colorB, colorA;
+
+private:
+    void simulateScalar(const ParticleUpdateParams& params, size_t begin);
+    void removeDead();
+
+    size_t capacity_ = 0;
+    size_t count_ = 0;
+};
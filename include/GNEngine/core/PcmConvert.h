@@ -0,0 +1,29 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * @class PcmConvert
+ * @brief 사운드 디코더 출력을 OpenAL 버퍼 형식으로 바꾸는 PCM 변환 커널 모음임.
+ *        AVX2로 빌드하면 16개, SSE2면 8개씩 처리하고 나머지는 스칼라로 처리함. 결과는 모든 경로에서 같음.
+ *        출력은 호출한 쪽이 준비한 버퍼에 바로 쓰며, 중간 버퍼를 할당하지 않음.
+ */
+class GNEngine_API PcmConvert {
+public:
+    /*
+     * @brief float 샘플([-1, 1])을 s16으로 바꿈. x * 32767을 0 방향으로 자르고 범위를 넘으면 포화시킴.
+     * @param count 샘플 수(채널 합산).
+     */
+    static void floatToS16(const float* in, int16_t* out, size_t count);
+
+    /*
+     * @brief 인터리브된 스테레오 s16(LRLR...)을 좌우 채널 배열로 나눔.
+     * @param frameCount 프레임 수. outLeft/outRight는 각각 frameCount개여야 함.
+     */
+    static void deinterleaveStereo(const int16_t* in, int16_t* outLeft, int16_t* outRight, size_t frameCount);
+
+    /* 인터리브된 스테레오 float를 s16으로 바꾸면서 좌우 채널로 나눔. floatToS16 + deinterleaveStereo와 결과가 같음. */
+    static void floatStereoToS16Planar(const float* in, int16_t* outLeft, int16_t* outRight, size_t frameCount);
+};
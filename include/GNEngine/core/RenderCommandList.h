@@ -0,0 +1,119 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+#include <SDL3/SDL.h>
+
+/*
+ * @class RenderCommandList
+ * @brief 한 프레임의 렌더링 명령을 SDL 호출 없이 기록하는 목록임.
+ *        좌표는 모두 렌더 타겟 픽셀 기준이며(카메라 변환이 끝난 값), RenderManager::execute가 백엔드로서 실행함.
+ *        명령마다 레이어 번호가 붙어 있어, 스레드별로 따로 기록한 목록을 appendMergedByLayer로 레이어 순서에 맞게 합칠 수 있음.
+ *        목록 하나는 스레드 안전하지 않으므로 스레드마다 자기 목록에만 기록해야 함.
+ *        saveToFile로 프레임을 덤프해 두면 loadFromFile과 bindTextures로 게임 없이 다시 실행(replay)할 수 있음.
+ *        타일맵, 파티클처럼 정점을 직접 만드는 드로우는 GEOMETRY 명령으로 정점까지 저장되므로 덤프만으로 같은 화면이 나옴.
+ */
+class GNEngine_API RenderCommandList {
+public:
+    enum class Type : uint8_t {
+        SPRITE,         /* 텍스처 쿼드 */
+        SPRITE_ROTATED, /* 회전된 텍스처 쿼드 */
+        FILL_RECT,      /* 색 사각형 (페이드 등) */
+        SET_BLEND_MODE, /* 이후 FILL_RECT의 블렌드 모드 */
+        BEGIN_VIEW,     /* 뷰포트와 카메라 상태 설정 (RenderManager::beginCameraView) */
+        END_VIEW,       /* 이전 뷰포트와 카메라 상태 복구 */
+        CUSTOM,         /* 렌더러에 직접 그리는 코드를 기록 순서대로 실행. 덤프에는 표시만 남음 */
+        GEOMETRY,       /* 쿼드 정점 묶음 (타일맵, 파티클 등). 정점은 목록의 정점 버퍼에 있음 */
+    };
+
+    static constexpr uint32_t NO_TEXTURE = UINT32_MAX;
+
+    struct Command {
+        Type type;
+        uint8_t layer;
+        SDL_FlipMode flip;
+        bool hasSrcRect;
+        SDL_Texture* texture;
+        uint32_t textureSlot; /* 덤프/로드 시 텍스처 표의 인덱스 */
+        SDL_FRect srcRect;
+        SDL_FRect dstRect;
+        SDL_FColor color;
+        float sinAngle, cosAngle;
+        float originX, originY; /* 회전 중심, BEGIN_VIEW에서는 카메라 위치 */
+        float zoom;
+        SDL_Rect viewport;
+        SDL_BlendMode blendMode; /* GEOMETRY에서는 그리는 동안만 쓸 블렌드 모드. SDL_BLENDMODE_INVALID면 바꾸지 않음 */
+        uint32_t callbackIndex;
+        uint32_t vertexOffset; /* GEOMETRY의 정점 버퍼 시작 위치 */
+        uint32_t quadCount;
+    };
+
+    /*
+     * 덤프 파일의 텍스처 표 항목. replay할 때 key로 같은 텍스처를 찾아 bindTextures로 넘김.
+     * key는 saveToFile에 넘긴 textureKey가 정하며, 찾을 수 없는 텍스처(렌더 타겟 등)는 빈 문자열임.
+     */
+    struct TextureInfo {
+        float width;
+        float height;
+        std::string key;
+    };
+    using TextureKeyFunction = std::function<std::string(SDL_Texture*)>;
+    using TextureResolver = std::function<SDL_Texture*(const TextureInfo&)>;
+
+    /* 이후 기록되는 명령에 붙일 레이어 번호. */
+    void setLayer(uint8_t layer) { layer_ = layer; }
+    uint8_t getLayer() const { return layer_; }
+
+    /* @param srcRect 텍스처의 픽셀 영역. nullptr이면 텍스처 전체. */
+    void drawSprite(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect,
+                    SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE);
+    void drawSpriteRotated(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, float sinAngle, float cosAngle,
+                           float originX, float originY, SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE);
+    void fillRect(const SDL_FRect& rect, SDL_FColor color);
+    void setBlendMode(SDL_BlendMode blendMode);
+    void beginView(const SDL_Rect& viewport, float cameraX, float cameraY, float zoom);
+    void endView();
+    void addCallback(std::function<void()> callback);
+    /* vertices의 쿼드 quadCount개(정점 4개씩)를 복사해 기록함. @param blendMode(SDL_BLENDMODE_INVALID) 그리는 동안만 쓸 블렌드 모드. */
+    void drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount, SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID);
+
+    /*
+     * @brief 여러 목록의 명령을 레이어 오름차순으로 이 목록 뒤에 붙임.
+     *        같은 레이어 안에서는 lists 순서, 그 안에서는 기록 순서를 유지함.
+     *        BEGIN_VIEW/END_VIEW 같은 상태 명령은 레이어를 가로지르므로, 합칠 목록에는 드로우 명령만 기록하는 것이 좋음.
+     */
+    void appendMergedByLayer(const std::vector<const RenderCommandList*>& lists);
+
+    void clear();
+    bool empty() const { return commands_.empty(); }
+    size_t size() const { return commands_.size(); }
+    const std::vector<Command>& getCommands() const { return commands_; }
+    const std::vector<std::function<void()>>& getCallbacks() const { return callbacks_; }
+    const std::vector<SDL_Vertex>& getVertices() const { return vertices_; }
+
+    /*
+     * @brief 명령, GEOMETRY 정점, 참조하는 텍스처의 크기와 키를 바이너리 파일로 저장함. CUSTOM 명령은 내용 없이 위치만 저장됨.
+     * @param textureKey(nullptr) 텍스처를 replay 때 다시 찾을 키(TextureManager::getTextureKey 등). nullptr이면 키를 비워 둠.
+     */
+    bool saveToFile(const std::filesystem::path& path, const TextureKeyFunction& textureKey = nullptr) const;
+    /* saveToFile로 저장한 파일을 읽음. 텍스처는 bindTextures 전까지 nullptr이며, CUSTOM 명령은 아무것도 하지 않음. */
+    bool loadFromFile(const std::filesystem::path& path);
+    const std::vector<TextureInfo>& getTextureInfos() const { return textureInfos_; }
+    /* textures[i]를 텍스처 표 i번 항목으로 보고 명령의 텍스처를 채움. */
+    void bindTextures(const std::vector<SDL_Texture*>& textures);
+    /* 텍스처 표의 항목마다 resolver로 텍스처를 찾아 채움. 예: key로 TextureManager::getTexture를 부름. */
+    void bindTextures(const TextureResolver& resolver);
+
+private:
+    Command& push(Type type);
+
+    std::vector<Command> commands_;
+    std::vector<std::function<void()>> callbacks_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<TextureInfo> textureInfos_;
+    uint8_t layer_ = 0;
+};
@@ -0,0 +1,116 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL.h>
+
+class JobManager;
+
+/*
+ * @class SoftwareRasterizer
+ * @brief SpriteBatch가 모은 쿼드를 CPU에서 그리는 타일 기반 래스터라이저임.
+ *        프레임 동안 삼각형을 모아 TILE_SIZE x TILE_SIZE 화면 타일로 나누고(binning),
+ *        endFrame에서 타일마다 JobManager 작업 하나로 병렬 래스터화함. 타일끼리 겹치지 않으므로 잠금이 없음.
+ *        결과는 프리멀티플라이드 ARGB8888 프레임 버퍼이며 getPixels나 getSurface로 읽음.
+ *        SDL_Texture는 픽셀을 읽을 수 없으므로, 그릴 텍스처는 addTexture로 CPU 사본을 등록해야 함.
+ * @param jobManager 타일 작업을 실행할 스레드 풀.
+ * @param width, height 프레임 버퍼 크기.
+ */
+class GNEngine_API SoftwareRasterizer {
+public:
+    static constexpr int TILE_SIZE = 64;
+
+    SoftwareRasterizer(JobManager& jobManager, int width, int height);
+    ~SoftwareRasterizer();
+
+    SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+    SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+
+    /* 프레임 버퍼 크기를 바꿈. 프레임 중간에 호출하면 안 됨. */
+    bool resize(int width, int height);
+
+    /*
+     * @brief texture로 그리는 쿼드가 사용할 CPU 픽셀 사본을 등록함.
+     *        surface는 ARGB8888로 변환하고 알파를 미리 곱해 복사하므로, 호출 후 해제해도 됨.
+     *        texture의 블렌드 모드가 SDL_BLENDMODE_BLEND_PREMULTIPLIED이면 surface도 이미 곱해져 있다고 봄.
+     *        샘플링 방식(nearest/linear)은 texture의 스케일 모드를 따름.
+     * @return 변환 성공 여부.
+     */
+    bool addTexture(SDL_Texture* texture, SDL_Surface* surface);
+    void removeTexture(SDL_Texture* texture);
+
+    /* 새 프레임을 시작함. 모든 타일은 endFrame에서 clearColor로 지워진 뒤 그려짐. 다른 출력 위에 합성할 때는 알파 0으로 비움. */
+    void beginFrame(SDL_Color clearColor);
+
+    /* 이후 제출되는 정점의 원점과 클립 영역을 viewport로 바꿈. nullptr이면 프레임 버퍼 전체임. */
+    void setViewport(const SDL_Rect* viewport);
+
+    /*
+     * @brief SpriteBatch 정점 배열(쿼드당 정점 4개, 0-1-2 / 2-3-0 순서)을 제출함.
+     *        정점 색은 쿼드 단위로 같다고 보고 첫 정점 색을 사용함.
+     * @param texture 등록된 텍스처. nullptr이면 정점 색으로 칠함.
+     */
+    void submit(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount);
+
+    /* 모인 삼각형을 래스터화함. 반환 후 프레임 버퍼를 읽을 수 있음. */
+    void endFrame();
+
+    const uint32_t* getPixels() const { return framebuffer_.data(); }
+    int getPitch() const { return width_ * static_cast<int>(sizeof(uint32_t)); }
+    int getWidth() const { return width_; }
+    int getHeight() const { return height_; }
+    /* 프레임 버퍼를 감싼 SDL_Surface. 소유권은 래스터라이저에 있으며 resize하면 바뀜. */
+    SDL_Surface* getSurface() const { return surface_; }
+
+    /* 통계. 마지막 endFrame에서 그린 삼각형 수와, 등록되지 않은 텍스처 때문에 버린 쿼드 수. */
+    size_t getTriangleCount() const { return triangleCount_; }
+    size_t getMissingTextureCount() const { return missingTextureCount_; }
+
+private:
+    /* 프리멀티플라이드 ARGB8888 픽셀 사본 */
+    struct RasterTexture {
+        int width = 0;
+        int height = 0;
+        bool isLinear = true;
+        std::vector<uint32_t> pixels;
+    };
+
+    /* 화면 좌표 삼각형. UV는 텍셀 단위, 색은 0~256 배율임. */
+    struct Triangle {
+        const RasterTexture* texture;
+        float x[3], y[3];
+        float u[3], v[3];
+        float area;
+        uint32_t colorScale[4]; /* r, g, b, a. 256이면 원본 그대로 */
+        bool isModulated;       /* colorScale 중 256이 아닌 값이 있는지 */
+        uint32_t solidColor;    /* texture가 없을 때 쓰는 프리멀티플라이드 색 */
+        int clipMinX, clipMinY, clipMaxX, clipMaxY; /* 포함 범위 */
+    };
+
+    void addTriangle(const RasterTexture* texture, const SDL_Vertex& a, const SDL_Vertex& b, const SDL_Vertex& c);
+    void rasterizeTile(size_t tileIndex);
+    void rasterizeTriangle(const Triangle& triangle, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY);
+    uint32_t sample(const Triangle& triangle, float u, float v) const;
+
+    JobManager& jobManager_;
+    int width_ = 0;
+    int height_ = 0;
+    int tilesX_ = 0;
+    int tilesY_ = 0;
+    std::vector<uint32_t> framebuffer_;
+    SDL_Surface* surface_ = nullptr;
+
+    uint32_t clearColor_ = 0xFF000000;
+    int viewportX_ = 0;
+    int viewportY_ = 0;
+    SDL_Rect clip_ = {0, 0, 0, 0};
+
+    std::unordered_map<SDL_Texture*, RasterTexture> textures_;
+    std::vector<Triangle> triangles_;
+    std::vector<std::vector<uint32_t>> tileBins_; /* 타일별 삼각형 인덱스. 제출 순서를 유지함 */
+
+    size_t triangleCount_ = 0;
+    size_t missingTextureCount_ = 0;
+};
@@ -2,6 +2,8 @@
 #include "../GNEngine_API.h"
 
 #include <AL/al.h>
+#include <cstdint>
+#include <filesystem>
 
 /*
  * 濡쒕뱶???ъ슫???곗씠???먯껜瑜??섑??대뒗 ?먯썝 ?대옒?ㅼ엫.
@@ -15,6 +17,12 @@ public:
      */
     Sound(ALuint monoBuffer, ALuint stereoBufferRight, bool isStereo);
 
+    /*
+     * 아직 버퍼가 없는 로딩 중 Sound를 만듦. SoundManager::loadSoundAsync가 먼저 돌려주는 핸들임.
+     * 디코딩이 끝나면 SoundManager가 소유 스레드에서 버퍼를 올리고 READY로 바꿈.
+     */
+    Sound();
+
     /*
      * ?뚮㈇?먯뿉???좊떦??OpenAL 踰꾪띁瑜??뺣━??
      */
@@ -30,10 +38,39 @@ public:
     ALuint getStereoBufferRight() const { return stereoBufferRight_; }
     bool isStereo() const { return isStereo_; }
 
+    /*
+     * EVICTED는 SoundManager가 메모리 한도 때문에 버퍼를 내린 상태임. 핸들은 그대로 유효하며,
+     * 다시 재생하려 하면 SoundManager가 같은 객체에 다시 불러옴.
+     */
+    enum class State : uint8_t { LOADING, READY, FAILED, EVICTED };
+    /* 상태는 소유 스레드(SoundManager::uploadPendingSounds를 부르는 스레드)에서만 바뀜 */
+    State getState() const { return state_; }
+    bool isReady() const { return state_ == State::READY; }
+    bool isFailed() const { return state_ == State::FAILED; }
+
+    /* 메모리 한도와 관계없이 내리지 않는지. SoundManager::pinSound로 바꿈 */
+    bool isPinned() const { return isPinned_; }
+    /* 올라가 있는 PCM 바이트 수. READY가 아니면 0 */
+    size_t getByteSize() const { return isReady() ? byteSize_ : 0; }
+
 private:
+    friend class SoundManager;
+    void setBuffers(ALuint monoBuffer, ALuint stereoBufferRight, bool isStereo);
+    void markFailed() { state_ = State::FAILED; }
+    /* 버퍼를 지우고 EVICTED로 바꿈. 재생 중인 보이스가 없을 때만 부름 */
+    void releaseBuffers();
+
     ALuint monoBuffer_;
     ALuint stereoBufferRight_;
     bool isStereo_ = false;
+    State state_ = State::READY;
+
+    // --- SoundManager 캐시가 관리하는 값 ---
+    std::filesystem::path path_; /* 다시 불러올 때 쓰는 캐시 키 */
+    size_t byteSize_ = 0;
+    uint64_t lastPlayed_ = 0;    /* LRU 순서. 재생하거나 올라올 때 갱신함 */
+    uint32_t voiceCount_ = 0;    /* 이 사운드를 쓰는 보이스 수 */
+    bool isPinned_ = false;
 };
 
 
@@ -0,0 +1,100 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <AL/al.h>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+ * @class SoundStream
+ * @brief 긴 음악 트랙을 파일에서 조금씩 디코딩해 재생하는 스트리밍 음원임.
+ *        Sound처럼 파일 전체를 PCM으로 풀지 않고, 작은 OpenAL 버퍼 BUFFER_COUNT개를 소스 큐에 돌려 씀.
+ *        SoundManager의 스트리밍 스레드가 update()로 재생이 끝난 버퍼를 꺼내 다음 구간을 디코딩해 다시 넣음.
+ *        PCM 메모리는 스트림당 (BUFFER_COUNT + 1) * BUFFER_FRAMES * 2채널 * 2바이트 = 80KB로 고정이며, 디코더 상태를 더해도 256KB를 넘지 않음.
+ *        반복 재생은 파일 끝에서 같은 버퍼를 채우는 도중 처음으로 되감아 이음매 없이 이어짐.
+ *        보이스 풀과 별개의 전용 소스를 쓰므로 효과음의 보이스 훔치기에 끊기지 않음. 공간화하지 않음(배경 음악용).
+ *        SoundManager::openStream으로만 만들 수 있고, 모든 함수는 메인 스레드와 스트리밍 스레드 양쪽에서 안전함.
+ */
+class GNEngine_API SoundStream {
+public:
+    static constexpr int BUFFER_COUNT = 4;          /* 소스 큐에 도는 버퍼 수 */
+    static constexpr size_t BUFFER_FRAMES = 4096;   /* 버퍼 하나의 PCM 프레임 수. 44.1kHz에서 약 93ms */
+
+    /* 파일 형식별 스트리밍 디코더. 구현은 SoundStream.cpp에 있음. */
+    struct Decoder;
+
+    ~SoundStream();
+
+    SoundStream(const SoundStream&) = delete;
+    SoundStream& operator=(const SoundStream&) = delete;
+    SoundStream(SoundStream&&) = delete;
+    SoundStream& operator=(SoundStream&&) = delete;
+
+    /*
+     * @brief 처음부터 재생을 시작함. 이미 재생 중이면 처음으로 되돌림.
+     * @param loop - 끝에 닿으면 처음부터 이어서 재생할지 여부.
+     */
+    bool play(float volume = 1.0f, bool loop = false);
+    void stop();
+    void pause();
+    void resume();
+
+    /*
+     * @brief 재생 위치를 seconds로 옮김. 큐에 있던 버퍼는 버리고 새 위치부터 다시 채움.
+     * @return 디코더가 위치를 옮기지 못하면 false.
+     */
+    bool seek(double seconds);
+
+    void setVolume(float volume);
+    void setLooping(bool loop);
+
+    /* 재생 중(일시 정지 제외)인지. 반복하지 않는 스트림은 마지막 버퍼가 끝나면 false가 됨. */
+    bool isPlaying() const;
+    bool isPaused() const;
+    bool isLooping() const;
+
+    /* @return 지금 들리는 위치(초). */
+    double getPosition() const;
+    /* @return 트랙 길이(초). 알 수 없으면 0. */
+    double getDuration() const;
+    ALuint getSourceId() const { return sourceId_; }
+
+private:
+    friend class SoundManager;
+
+    /* 파일을 열고 소스와 버퍼를 만듦. 지원하지 않는 형식이거나 3채널 이상이면 nullptr. */
+    static std::shared_ptr<SoundStream> open(const std::filesystem::path& filePath);
+    explicit SoundStream(std::unique_ptr<Decoder> decoder);
+
+    /* 스트리밍 스레드에서 주기적으로 호출함. 처리된 버퍼를 다시 채우고, 버퍼가 모자라 멈춘 소스를 다시 재생함. */
+    void update();
+    /* 컨텍스트가 사라지기 전에 SoundManager가 호출함. 이후 이 스트림은 아무것도 하지 않음. */
+    void releaseAL();
+
+    /* mutex_를 잡은 상태에서만 호출함. */
+    void rewindLocked(uint64_t frame);
+    bool fillBufferLocked(ALuint buffer);
+
+    std::unique_ptr<Decoder> decoder_;
+    mutable std::mutex mutex_;
+
+    ALuint sourceId_ = 0;
+    ALuint buffers_[BUFFER_COUNT] = {};
+    ALenum format_ = 0;
+    std::vector<int16_t> pcm_; /* 디코딩 작업 버퍼. BUFFER_FRAMES * 채널 수 */
+
+    /* 큐에 들어간 순서대로 각 버퍼의 시작 프레임. getPosition에 씀 */
+    uint64_t queuedStartFrames_[BUFFER_COUNT] = {};
+    int queueHead_ = 0;
+    int queueCount_ = 0;
+
+    uint64_t cursorFrame_ = 0; /* 다음에 디코딩할 프레임 */
+    float volume_ = 1.0f;
+    bool isActive_ = false;      /* play 이후 stop이나 끝에 닿기 전까지 true */
+    bool isPaused_ = false;
+    bool isLooping_ = false;
+    bool isEndOfStream_ = false; /* 반복하지 않는 스트림의 마지막 구간까지 큐에 넣음 */
+};
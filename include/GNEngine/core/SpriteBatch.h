@@ -0,0 +1,79 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <vector>
+#include <SDL3/SDL.h>
+
+class SoftwareRasterizer;
+
+/*
+ * @class SpriteBatch
+ * @brief 텍스처가 같은 쿼드를 모아 SDL_RenderGeometry 한 번으로 그리는 배치임.
+ *        텍스처가 바뀌거나 버퍼가 가득 차거나 flush가 호출되면 모인 쿼드를 그림.
+ *        배치 밖에서 렌더러에 직접 그리기 전에는 반드시 flush해서 그리는 순서를 지켜야 함.
+ */
+class GNEngine_API SpriteBatch {
+public:
+    static constexpr size_t MAX_QUADS = 8192; /* 한 번에 그리는 최대 쿼드 수 */
+
+    SpriteBatch(SDL_Renderer* renderer);
+
+    /*
+     * @brief 쿼드 하나를 배치에 추가함.
+     * @param texture 그릴 텍스처. nullptr이면 색만 칠함.
+     * @param srcRect 텍스처의 픽셀 영역. nullptr이면 텍스처 전체.
+     * @param dstRect 렌더 타겟 기준 픽셀 영역.
+     * @param color 정점 색. 텍스처 색에 곱해짐. 스트레이트 알파로 넘기며, 프리멀티플라이드 텍스처에 그릴 때는 배치가 알파를 곱해 줌.
+     */
+    void draw(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect,
+              SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE);
+
+    /*
+     * @brief 회전된 쿼드 하나를 배치에 추가함. 정점을 직접 회전시키므로 회전하지 않은 쿼드와 같은 배치로 그려짐.
+     * @param sinAngle, cosAngle 회전각의 sin/cos. 여러 스프라이트를 그릴 때 FastMath::sinCosDegrees로 한꺼번에 구해 넘김.
+     * @param originX, originY 회전 중심. 렌더 타겟 기준 픽셀 좌표.
+     */
+    void drawRotated(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, float sinAngle, float cosAngle,
+                     float originX, float originY, SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE);
+
+    /*
+     * @brief 이미 만든 쿼드 정점(쿼드당 4개, 0-1-2 / 2-3-0 순서)을 배치에 추가함. 타일맵 청크나 파티클처럼 정점을 직접 만드는 곳에서 씀.
+     * @param vertices 렌더 타겟 픽셀 좌표, 0~1 UV, 스트레이트 알파 색. 프리멀티플라이드 텍스처면 draw처럼 배치가 알파를 곱해 줌.
+     */
+    void drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount);
+
+    /* 모인 쿼드를 그리고 배치를 비움. */
+    void flush();
+
+    /* rasterizer가 있으면 flush가 SDL_RenderGeometry 대신 CPU 래스터라이저에 쿼드를 제출함. nullptr이면 다시 SDL로 그림. */
+    void setRasterizer(SoftwareRasterizer* rasterizer) { flush(); rasterizer_ = rasterizer; }
+
+    /* 통계. resetStats 이후 flush로 발생한 드로우 콜 수와 그린 쿼드 수. */
+    size_t getDrawCallCount() const { return drawCallCount_; }
+    size_t getQuadCount() const { return quadCount_; }
+    void resetStats() { drawCallCount_ = 0; quadCount_ = 0; }
+
+private:
+    /* 텍스처 전환과 UV 계산. 추가할 쿼드의 u0, v0, u1, v1을 돌려줌. */
+    void prepareQuad(SDL_Texture* texture, const SDL_FRect* srcRect, SDL_FlipMode flip, float& u0, float& v0, float& u1, float& v1);
+    /* SDL_RenderGeometry로 프리멀티플라이드 텍스처를 그릴 때 반투명 정점 색의 rgb에 알파를 곱함. 래스터라이저는 스스로 곱함. */
+    SDL_FColor toVertexColor(SDL_FColor color) const {
+        if (isCurrentPremultiplied_ && color.a < 1.0f && !rasterizer_) {
+            return {color.r * color.a, color.g * color.a, color.b * color.a, color.a};
+        }
+        return color;
+    }
+
+    SDL_Renderer* renderer_;
+    SoftwareRasterizer* rasterizer_ = nullptr;
+    SDL_Texture* currentTexture_ = nullptr;
+    float currentTextureWidth_ = 1.0f;
+    float currentTextureHeight_ = 1.0f;
+    bool isCurrentPremultiplied_ = false; /* 현재 텍스처 블렌드 모드가 프리멀티플라이드(BLEND/ADD)인지 */
+
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_;
+
+    size_t drawCallCount_ = 0;
+    size_t quadCount_ = 0;
+};
@@ -0,0 +1,343 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ANIMATION_GNENGINE_ANIM_H_
+#define FLATBUFFERS_GENERATED_ANIMATION_GNENGINE_ANIM_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace GNEngine {
+namespace anim {
+
+struct Frame;
+
+struct FrameEvent;
+struct FrameEventBuilder;
+
+struct Clip;
+struct ClipBuilder;
+
+struct AnimationSet;
+struct AnimationSetBuilder;
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Frame FLATBUFFERS_FINAL_CLASS {
+ private:
+  int32_t x_;
+  int32_t y_;
+  int32_t w_;
+  int32_t h_;
+  int32_t duration_ms_;
+
+ public:
+  Frame()
+      : x_(0),
+        y_(0),
+        w_(0),
+        h_(0),
+        duration_ms_(0) {
+  }
+  Frame(int32_t _x, int32_t _y, int32_t _w, int32_t _h, int32_t _duration_ms)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        w_(::flatbuffers::EndianScalar(_w)),
+        h_(::flatbuffers::EndianScalar(_h)),
+        duration_ms_(::flatbuffers::EndianScalar(_duration_ms)) {
+  }
+  int32_t x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  int32_t y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  int32_t w() const {
+    return ::flatbuffers::EndianScalar(w_);
+  }
+  int32_t h() const {
+    return ::flatbuffers::EndianScalar(h_);
+  }
+  int32_t duration_ms() const {
+    return ::flatbuffers::EndianScalar(duration_ms_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Frame, 20);
+
+struct FrameEvent FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef FrameEventBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FRAME = 4,
+    VT_NAME = 6
+  };
+  int32_t frame() const {
+    return GetField<int32_t>(VT_FRAME, 0);
+  }
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_FRAME, 4) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           verifier.EndTable();
+  }
+};
+
+struct FrameEventBuilder {
+  typedef FrameEvent Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_frame(int32_t frame) {
+    fbb_.AddElement<int32_t>(FrameEvent::VT_FRAME, frame, 0);
+  }
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(FrameEvent::VT_NAME, name);
+  }
+  explicit FrameEventBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<FrameEvent> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<FrameEvent>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<FrameEvent> CreateFrameEvent(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t frame = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0) {
+  FrameEventBuilder builder_(_fbb);
+  builder_.add_name(name);
+  builder_.add_frame(frame);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<FrameEvent> CreateFrameEventDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t frame = 0,
+    const char *name = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  return GNEngine::anim::CreateFrameEvent(
+      _fbb,
+      frame,
+      name__);
+}
+
+struct Clip FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ClipBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_SPRITESHEET_PATH = 6,
+    VT_LOOP = 8,
+    VT_FRAMES = 10,
+    VT_EVENTS = 12
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  const ::flatbuffers::String *spritesheet_path() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SPRITESHEET_PATH);
+  }
+  bool loop() const {
+    return GetField<uint8_t>(VT_LOOP, 1) != 0;
+  }
+  const ::flatbuffers::Vector<const GNEngine::anim::Frame *> *frames() const {
+    return GetPointer<const ::flatbuffers::Vector<const GNEngine::anim::Frame *> *>(VT_FRAMES);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>> *events() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>> *>(VT_EVENTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_SPRITESHEET_PATH) &&
+           verifier.VerifyString(spritesheet_path()) &&
+           VerifyField<uint8_t>(verifier, VT_LOOP, 1) &&
+           VerifyOffset(verifier, VT_FRAMES) &&
+           verifier.VerifyVector(frames()) &&
+           VerifyOffset(verifier, VT_EVENTS) &&
+           verifier.VerifyVector(events()) &&
+           verifier.VerifyVectorOfTables(events()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ClipBuilder {
+  typedef Clip Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(Clip::VT_NAME, name);
+  }
+  void add_spritesheet_path(::flatbuffers::Offset<::flatbuffers::String> spritesheet_path) {
+    fbb_.AddOffset(Clip::VT_SPRITESHEET_PATH, spritesheet_path);
+  }
+  void add_loop(bool loop) {
+    fbb_.AddElement<uint8_t>(Clip::VT_LOOP, static_cast<uint8_t>(loop), 1);
+  }
+  void add_frames(::flatbuffers::Offset<::flatbuffers::Vector<const GNEngine::anim::Frame *>> frames) {
+    fbb_.AddOffset(Clip::VT_FRAMES, frames);
+  }
+  void add_events(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>>> events) {
+    fbb_.AddOffset(Clip::VT_EVENTS, events);
+  }
+  explicit ClipBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<Clip> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<Clip>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<Clip> CreateClip(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> spritesheet_path = 0,
+    bool loop = true,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const GNEngine::anim::Frame *>> frames = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>>> events = 0) {
+  ClipBuilder builder_(_fbb);
+  builder_.add_events(events);
+  builder_.add_frames(frames);
+  builder_.add_spritesheet_path(spritesheet_path);
+  builder_.add_name(name);
+  builder_.add_loop(loop);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<Clip> CreateClipDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const char *spritesheet_path = nullptr,
+    bool loop = true,
+    const std::vector<GNEngine::anim::Frame> *frames = nullptr,
+    const std::vector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>> *events = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto spritesheet_path__ = spritesheet_path ? _fbb.CreateString(spritesheet_path) : 0;
+  auto frames__ = frames ? _fbb.CreateVectorOfStructs<GNEngine::anim::Frame>(*frames) : 0;
+  auto events__ = events ? _fbb.CreateVector<::flatbuffers::Offset<GNEngine::anim::FrameEvent>>(*events) : 0;
+  return GNEngine::anim::CreateClip(
+      _fbb,
+      name__,
+      spritesheet_path__,
+      loop,
+      frames__,
+      events__);
+}
+
+struct AnimationSet FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef AnimationSetBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CLIPS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::Clip>> *clips() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::Clip>> *>(VT_CLIPS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_CLIPS) &&
+           verifier.VerifyVector(clips()) &&
+           verifier.VerifyVectorOfTables(clips()) &&
+           verifier.EndTable();
+  }
+};
+
+struct AnimationSetBuilder {
+  typedef AnimationSet Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_clips(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::Clip>>> clips) {
+    fbb_.AddOffset(AnimationSet::VT_CLIPS, clips);
+  }
+  explicit AnimationSetBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<AnimationSet> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<AnimationSet>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<AnimationSet> CreateAnimationSet(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<GNEngine::anim::Clip>>> clips = 0) {
+  AnimationSetBuilder builder_(_fbb);
+  builder_.add_clips(clips);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<AnimationSet> CreateAnimationSetDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<GNEngine::anim::Clip>> *clips = nullptr) {
+  auto clips__ = clips ? _fbb.CreateVector<::flatbuffers::Offset<GNEngine::anim::Clip>>(*clips) : 0;
+  return GNEngine::anim::CreateAnimationSet(
+      _fbb,
+      clips__);
+}
+
+inline const GNEngine::anim::AnimationSet *GetAnimationSet(const void *buf) {
+  return ::flatbuffers::GetRoot<GNEngine::anim::AnimationSet>(buf);
+}
+
+inline const GNEngine::anim::AnimationSet *GetSizePrefixedAnimationSet(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<GNEngine::anim::AnimationSet>(buf);
+}
+
+inline const char *AnimationSetIdentifier() {
+  return "GNAN";
+}
+
+inline bool AnimationSetBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, AnimationSetIdentifier());
+}
+
+inline bool SizePrefixedAnimationSetBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, AnimationSetIdentifier(), true);
+}
+
+inline bool VerifyAnimationSetBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<GNEngine::anim::AnimationSet>(AnimationSetIdentifier());
+}
+
+inline bool VerifySizePrefixedAnimationSetBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<GNEngine::anim::AnimationSet>(AnimationSetIdentifier());
+}
+
+inline const char *AnimationSetExtension() {
+  return "gnanim";
+}
+
+inline void FinishAnimationSetBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GNEngine::anim::AnimationSet> root) {
+  fbb.Finish(root, AnimationSetIdentifier());
+}
+
+inline void FinishSizePrefixedAnimationSetBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<GNEngine::anim::AnimationSet> root) {
+  fbb.FinishSizePrefixed(root, AnimationSetIdentifier());
+}
+
+}  // namespace anim
+}  // namespace GNEngine
+
+#endif  // FLATBUFFERS_GENERATED_ANIMATION_GNENGINE_ANIM_H_
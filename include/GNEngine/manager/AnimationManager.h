@@ -6,8 +6,10 @@
 #include <filesystem>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 #include "GNEngine/core/Animation.h"
+#include "GNEngine/core/AnimationStateMachine.h"
 
 /* --- 전방선언 --- */
 class TextureManager;
@@ -15,7 +17,7 @@ class TextureManager;
 /*
  * @class AnimationManager
  * @brief 애니메이션 데이터를 관리하는 매니저.
- * JSON 파일을 파싱하여 Animation 객체를 생성하고 캐시에 저장하는 역할을 함.
+ * JSON 파일 또는 미리 변환한 FlatBuffers 바이너리(.gnanim, 스키마는 animation.fbs)를 읽어 Animation 객체를 생성하고 캐시에 저장하는 역할을 함.
  * @note이 클래스는 애니메이션 데이터의 로딩과 접근을 담당하며, 실제 렌더링이나 상태 관리는 하지 않음.
  */ 
 class GNEngine_API AnimationManager {
@@ -24,7 +26,13 @@ public:
         : textureManager_(textureManager) {}
     ~AnimationManager() = default;
 
-    bool loadAnimation(const std::filesystem::path& jsonPath);
+    static constexpr const char* BINARY_EXTENSION = ".gnanim";
+
+    bool loadAnimation(const std::filesystem::path& path);
+    bool loadAnimationBinary(const std::filesystem::path& binaryPath);
+
+    /* 애니메이션 JSON을 .gnanim 바이너리로 변환함. 오프라인 변환 도구용이며 캐시에는 넣지 않음. */
+    static bool convertJsonToBinary(const std::filesystem::path& jsonPath, const std::filesystem::path& binaryPath);
 
     /*
      * @brief 캐시에서 애니메이션 데이터를 가져옴.
@@ -33,10 +41,43 @@ public:
      */
     std::shared_ptr<Animation> getAnimation(const std::string& animationName);
 
+    /*
+     * @brief 캐시된 애니메이션의 AnimationTable 핸들을 가져옴. 불러올 때 이미 표에 등록되어 있음.
+     * @return 찾지 못하면 INVALID_ANIMATION_HANDLE.
+     */
+    AnimationHandle getAnimationHandle(const std::string& animationName);
+
     void setScaleModeOfAnimation(const std::string& animationName, SDL_ScaleMode scaleMode);
 
+    /*
+     * @brief 상태 머신 JSON({"stateMachines": {"이름": {...}}})을 읽어 정의를 만듦.
+     *        상태가 참조하는 애니메이션은 먼저 loadAnimation으로 불러와 있어야 함.
+     * @return 파일을 열지 못했거나 JSON 구조가 잘못되었으면 false.
+     */
+    bool loadStateMachine(const std::filesystem::path& jsonPath);
+
+    /*
+     * @brief 불러온 상태 머신 정의를 가져옴. 포인터는 AnimationManager가 살아 있는 동안 유효함.
+     * @return 찾지 못하면 nullptr.
+     */
+    const AnimationStateMachine* getStateMachine(const std::string& name) const;
+
 private:
+    /* JSON에서 읽은 애니메이션 하나. 바이너리 변환과 JSON 로딩이 함께 씀. */
+    struct AnimationDesc {
+        std::string name;
+        std::string spritesheetPath; /* JSON 파일 기준 상대 경로 */
+        bool loop = true;
+        std::vector<SDL_Rect> frames;
+        std::vector<int> durations;  /* 밀리초 */
+        std::vector<std::string> events; /* 프레임별 이벤트 이름. 없으면 빈 문자열 */
+    };
+
+    static bool parseAnimationJson(const std::filesystem::path& jsonPath, std::vector<AnimationDesc>& descs);
+    void cacheAnimation(const std::string& animName, std::shared_ptr<Animation> animation, const std::filesystem::path& sourcePath);
+
     std::unordered_map<std::string, std::shared_ptr<Animation>> animationCache_;
+    std::unordered_map<std::string, std::unique_ptr<AnimationStateMachine>> stateMachines_;
 
     TextureManager& textureManager_;
 };
@@ -0,0 +1,139 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <SDL3/SDL.h>
+
+/*
+ * @class CaptureManager
+ * @brief 스크린샷과 연속 프레임 덤프를 메인 루프를 멈추지 않고 저장하는 매니저임.
+ *        메인 스레드는 present 직전에 프레임을 미리 할당해 둔 버퍼 풀에 복사만 하고,
+ *        PNG/BMP 인코딩과 파일 쓰기는 전용 워커 스레드가 함.
+ *        버퍼가 모두 사용 중이면 dropPolicy에 따라 새 프레임이나 가장 오래된 대기 프레임을 버리므로 큐 깊이가 bufferCount를 넘지 않음.
+ *        RenderManager::setCaptureManager로 연결하면 RenderManager::present가 매 프레임 advanceFrame과 캡처를 호출함.
+ * @param bufferCount(4) 재사용하는 프레임 버퍼 수. 대기 + 인코딩 중인 프레임의 최대 개수임.
+ * @param workerCount(1) 인코딩 워커 스레드 수.
+ * @param dropPolicy(DROP_OLDEST) 버퍼가 부족할 때 버릴 프레임.
+ */
+class GNEngine_API CaptureManager {
+public:
+    enum class Format {
+        PNG,
+        BMP,
+        RAW, /* 헤더 없는 ARGB8888 픽셀. ffmpeg -f rawvideo -pix_fmt bgra -s WxH 로 읽을 수 있음 */
+    };
+
+    enum class DropPolicy {
+        DROP_NEWEST, /* 새 프레임을 버림. 이미 큐에 들어간 프레임은 모두 저장됨 */
+        DROP_OLDEST, /* 아직 인코딩을 시작하지 않은 가장 오래된 프레임을 버리고 새 프레임을 넣음 */
+    };
+
+    struct Stats {
+        uint64_t requested = 0; /* 캡처하려 한 프레임 수 */
+        uint64_t written = 0;
+        uint64_t dropped = 0;
+        uint64_t failed = 0;
+        double averageReadbackMs = 0.0; /* 메인 스레드에서 쓴 시간(읽기 + 버퍼 복사) */
+        double maxReadbackMs = 0.0;
+        double averageLatencyMs = 0.0;  /* 캡처 요청부터 파일 쓰기 완료까지 */
+        double maxLatencyMs = 0.0;
+        double framesPerSecond = 0.0;   /* 첫 캡처부터 마지막 쓰기 완료까지의 저장 처리량 */
+        double megabytesPerSecond = 0.0;
+    };
+
+    explicit CaptureManager(size_t bufferCount = 4, size_t workerCount = 1, DropPolicy dropPolicy = DropPolicy::DROP_OLDEST);
+    /* 대기 중인 프레임을 모두 저장한 뒤 워커를 종료함. */
+    ~CaptureManager();
+
+    CaptureManager(const CaptureManager&) = delete;
+    CaptureManager& operator=(const CaptureManager&) = delete;
+
+    /* 다음 프레임을 path에 저장하도록 예약함. */
+    void requestScreenshot(const std::filesystem::path& path, Format format = Format::PNG);
+
+    /*
+     * @brief frameInterval 프레임마다 directory/frame_000000.<ext> 형식으로 저장함. 파일 번호는 present된 프레임 번호임.
+     * @return 디렉터리를 만들 수 없으면 false.
+     */
+    bool startRecording(const std::filesystem::path& directory, Format format = Format::PNG, int frameInterval = 1);
+    void stopRecording();
+    bool isRecording() const { return isRecording_; }
+
+    /* 프레임 번호를 하나 올리고, 이번 프레임에 캡처할 것이 있는지 돌려줌. present마다 한 번 호출함. */
+    bool advanceFrame();
+
+    /* 렌더러의 현재 타겟을 SDL_RenderReadPixels로 읽어 캡처함. SDL_RenderPresent 전에 호출해야 함. */
+    void captureRenderer(SDL_Renderer* renderer);
+    /* 이미 CPU에 있는 프레임(SoftwareRasterizer 등)을 복사해 캡처함. */
+    void capturePixels(const void* pixels, int width, int height, int pitch, SDL_PixelFormat format);
+
+    /* 큐에 들어간 프레임이 모두 저장될 때까지 기다림. */
+    void flush();
+
+    Stats getStats() const;
+    void logStats() const;
+
+private:
+    struct Job {
+        std::filesystem::path path;
+        Format format = Format::PNG;
+    };
+
+    struct FrameBuffer {
+        std::vector<uint8_t> pixels;
+        int width = 0;
+        int height = 0;
+        int pitch = 0;
+        SDL_PixelFormat pixelFormat = SDL_PIXELFORMAT_UNKNOWN;
+        Job job;
+        uint64_t requestTicksNS = 0;
+    };
+
+    /* 빈 버퍼 인덱스를 얻음. 없으면 dropPolicy에 따라 대기 프레임을 버리거나 SIZE_MAX를 돌려줌. mutex_를 잡은 상태로 호출함. */
+    size_t acquireBuffer();
+    void enqueue(const void* pixels, int width, int height, int pitch, SDL_PixelFormat format, uint64_t requestTicksNS);
+    void workerLoop();
+    bool encode(FrameBuffer& buffer);
+    static const char* getExtension(Format format);
+
+    DropPolicy dropPolicy_;
+    std::vector<FrameBuffer> buffers_;
+    std::vector<size_t> freeBuffers_;
+    std::deque<size_t> pendingBuffers_;
+    std::vector<std::thread> workers_;
+    mutable std::mutex mutex_;
+    std::condition_variable frameAvailable_;
+    std::condition_variable idle_;
+    size_t encodingCount_ = 0;
+    bool isStopping_ = false;
+
+    /* 메인 스레드 전용 */
+    std::vector<Job> screenshotRequests_;
+    std::vector<Job> frameJobs_;
+    bool isRecording_ = false;
+    std::filesystem::path recordDirectory_;
+    Format recordFormat_ = Format::PNG;
+    int recordInterval_ = 1;
+    uint64_t recordStartFrame_ = 0;
+    uint64_t frameIndex_ = 0;
+
+    /* 통계. mutex_로 보호함 */
+    uint64_t requested_ = 0;
+    uint64_t written_ = 0;
+    uint64_t dropped_ = 0;
+    uint64_t failed_ = 0;
+    uint64_t writtenBytes_ = 0;
+    uint64_t readbackCount_ = 0;
+    uint64_t readbackNs_ = 0;
+    uint64_t maxReadbackNs_ = 0;
+    uint64_t latencyNs_ = 0;
+    uint64_t maxLatencyNs_ = 0;
+    uint64_t firstRequestTicksNS_ = 0;
+    uint64_t lastWrittenTicksNS_ = 0;
+};
@@ -60,7 +60,7 @@ public:
      * @tparam Args 컴포넌트 생성자의 파라미터
     */
     template<typename T, typename... Args>
-    auto addComponent(EntityID entity, Args&&... args) -> std::conditional_t<std::is_same_v<T, TransformComponent> || std::is_same_v<T, RenderComponent> || std::is_same_v<T, AnimationComponent> || std::is_same_v<T, TextComponent> || std::is_same_v<T, CameraComponent> || std::is_same_v<T, VelocityComponent> || std::is_same_v<T, AccelerationComponent> || std::is_same_v<T, TextComponent>, void, T&>
+    auto addComponent(EntityID entity, Args&&... args) -> std::conditional_t<std::is_same_v<T, TransformComponent> || std::is_same_v<T, RenderComponent> || std::is_same_v<T, AnimationComponent> || std::is_same_v<T, TextComponent> || std::is_same_v<T, CameraComponent> || std::is_same_v<T, VelocityComponent> || std::is_same_v<T, AccelerationComponent> || std::is_same_v<T, AnimationStateMachineComponent>, void, T&>
     {
         std::type_index type = typeid(T);
         if (componentTypes_.find(type) == componentTypes_.end()) {
@@ -77,7 +77,7 @@ public:
         entitySignatures_[entity].set(componentTypes_[type]);
 
         // If T component type is SoA
-        if constexpr (!std::is_same_v<T, TransformComponent> && !std::is_same_v<T, RenderComponent> && !std::is_same_v<T, AnimationComponent> && !std::is_same_v<T, TextComponent> && !std::is_same_v<T, CameraComponent> && !std::is_same_v<T, VelocityComponent> && !std::is_same_v<T, AccelerationComponent>) {
+        if constexpr (!std::is_same_v<T, TransformComponent> && !std::is_same_v<T, RenderComponent> && !std::is_same_v<T, AnimationComponent> && !std::is_same_v<T, TextComponent> && !std::is_same_v<T, CameraComponent> && !std::is_same_v<T, VelocityComponent> && !std::is_same_v<T, AccelerationComponent> && !std::is_same_v<T, AnimationStateMachineComponent>) {
             return componentArray->getComponent(entity);
         }
     }
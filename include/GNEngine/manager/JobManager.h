@@ -0,0 +1,52 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * @class JobManager
+ * @brief 워커 스레드 풀에서 작업을 실행하는 매니저임.
+ *        submit으로 던져 두는 비동기 작업과, 호출한 스레드도 함께 일하고 끝날 때까지 기다리는 parallelFor를 제공함.
+ * @param threadCount(0) 워커 스레드 수. 0이면 (하드웨어 스레드 수 - 1)개를 만듦.
+ */
+class GNEngine_API JobManager {
+public:
+    explicit JobManager(size_t threadCount = 0);
+    ~JobManager();
+
+    JobManager(const JobManager&) = delete;
+    JobManager& operator=(const JobManager&) = delete;
+
+    /* 작업을 큐에 넣음. 워커 스레드 중 하나가 실행함. */
+    void submit(std::function<void()> job);
+
+    /*
+     * @brief job(0) ~ job(count - 1)을 워커와 호출 스레드에서 나눠 실행하고 모두 끝날 때까지 기다림.
+     *        인덱스는 원자적 카운터로 하나씩 가져가므로 작업마다 비용이 달라도 균형이 맞음.
+     *        도우미 작업은 submit 작업보다 먼저 실행되도록 큐 앞에 넣으며, 워커가 모두 바쁘면 호출 스레드가 혼자 끝내고
+     *        아직 시작하지 않은 도우미는 기다리지 않음.
+     */
+    void parallelFor(size_t count, const std::function<void(size_t)>& job);
+
+    /* 큐가 비고 실행 중인 작업이 없을 때까지 기다림. */
+    void waitIdle();
+
+    size_t getThreadCount() const { return workers_.size(); }
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    std::condition_variable idle_;
+    size_t activeJobs_ = 0;
+    bool isStopping_ = false;
+};
@@ -3,6 +3,12 @@
 
 #include <SDL3/SDL.h>
 #include "GNEngine/core/Texture.h"
+#include "GNEngine/core/SpriteBatch.h"
+#include "GNEngine/core/RenderCommandList.h"
+
+class SoftwareRasterizer;
+class TextureManager;
+class CaptureManager;
 
 class GNEngine_API RenderManager {
 private:
@@ -14,6 +20,41 @@ private:
     float zoomLevel_ = 1.0f;
     SDL_Color backgroundColor = {0, 0, 0, 255}; // black
 
+    /* 오프스크린 패스 상태. 활성화 중에는 월드 좌표를 (x - passOrigin) * zoom 으로 타겟 텍스처에 그림. */
+    SDL_Texture* passTarget_ = nullptr;
+    SDL_Texture* passPrevTarget_ = nullptr;
+    float passOriginX_ = 0.0f;
+    float passOriginY_ = 0.0f;
+
+    /* 카메라 뷰 상태. 활성화 중에는 뷰포트 크기를 화면 크기로 보고, 끝나면 이전 카메라/뷰포트를 복구함. */
+    bool isInCameraView_ = false;
+    int viewWidth_ = 0;
+    int viewHeight_ = 0;
+    SDL_Rect prevViewport_ = {0, 0, 0, 0};
+    float prevCameraX_ = 0.0f;
+    float prevCameraY_ = 0.0f;
+    float prevZoomLevel_ = 1.0f;
+
+    SpriteBatch spriteBatch_; /* renderTexture/renderUITexture/drawSprite가 쌓는 스프라이트 배치 */
+
+    bool isPresentSkipped_ = false;     /* 이번 프레임의 present를 건너뛸지 */
+    bool wasLastPresentSkipped_ = false;
+
+    /* CPU 래스터라이저 백엔드 상태. 설정되면 스프라이트 배치가 SDL 대신 rasterizer_로 그림. */
+    SoftwareRasterizer* rasterizer_ = nullptr;
+    bool isRasterPresented_ = true;
+    SDL_Texture* rasterTexture_ = nullptr; /* 래스터 결과를 화면에 올리는 스트리밍 텍스처 */
+
+    /* 기록 중이면 드로우 함수가 SDL 대신 이 목록에 명령을 추가함. 오프스크린 패스 동안에는 잠시 내려 둠. */
+    RenderCommandList* recordList_ = nullptr;
+    RenderCommandList* passRecordList_ = nullptr;
+
+    TextureManager* textureManager_ = nullptr; /* 축소본 텍스처를 찾을 곳. nullptr이면 항상 원본으로 그림 */
+    CaptureManager* captureManager_ = nullptr;
+
+    void presentRasterFrame();
+    SDL_Texture* selectScaledVariant(SDL_Texture* texture, SDL_FRect& srcFRect, bool& hasSrcRect, const SDL_FRect& dstRect);
+
 public:
     RenderManager(SDL_Renderer* renderer, SDL_Window* window);
     ~RenderManager();
@@ -21,20 +62,61 @@ public:
     void clear();
     void present();
 
+    /*
+     * @brief 이번 프레임의 present를 건너뜀. 화면이 이전 프레임과 같을 때 RenderSystem이 호출함.
+     *        VSync 대기도 함께 사라지므로, 메인 루프는 wasLastPresentSkipped로 확인해 직접 쉬어야 함.
+     */
+    void skipPresent() { isPresentSkipped_ = true; }
+    bool wasLastPresentSkipped() const { return wasLastPresentSkipped_; }
+
     void setViewport(SDL_Rect viewport) { SDL_SetRenderViewport(renderer_, &viewport); }
     
+    /*
+     * @brief 스프라이트 배치를 CPU 타일 래스터라이저로 그리게 함. nullptr이면 SDL 렌더러로 돌아감.
+     *        clear는 래스터라이저 프레임을 시작하고, present는 래스터화를 끝냄.
+     *        SpriteBatch를 거치는 드로우(스프라이트, 텍스트, 타일맵, 파티클, fillRect)가 모두 래스터화되어 레이어 순서가 유지됨.
+     *        래스터라이저는 블렌드 모드를 구분하지 않으므로 가산(ADD) 파티클도 일반 알파 블렌드로 그려짐.
+     *        래스터라이저가 있는 동안 오프스크린 패스는 실패하므로 RenderSystem은 정적 레이어 캐시 없이 그림.
+     * @param isPresentedToRenderer(true) true면 present에서 결과를 스트리밍 텍스처로 올려 SDL 렌더러에 그린 뒤 표시함.
+     *        이때 래스터 프레임은 투명하게 비우고 배경색은 SDL 렌더러에만 칠함.
+     *        false면 래스터 프레임을 배경색으로 비우며, 결과는 rasterizer의 getSurface/getPixels로만 읽음(헤드리스 벤치마크 등).
+     */
+    void setRasterizer(SoftwareRasterizer* rasterizer, bool isPresentedToRenderer = true);
+    SoftwareRasterizer* getRasterizer() const { return rasterizer_; }
+
+    /*
+     * @brief 월드 공간 스프라이트를 축소해서 그릴 때 TextureManager의 축소본 캐시(enableScaledVariants)를 쓰게 함.
+     *        CPU 래스터라이저를 쓰는 동안에는 축소본이 래스터라이저에 등록되어 있지 않으므로 원본으로 그림.
+     */
+    void setTextureManager(TextureManager* textureManager) { textureManager_ = textureManager; }
+    TextureManager* getTextureManager() const { return textureManager_; }
+
+    /*
+     * @brief present할 때마다 완성된 프레임을 captureManager에 넘김. 래스터라이저를 쓰면 그 프레임 버퍼를, 아니면 렌더러를 읽음.
+     *        present를 건너뛴 프레임은 캡처되지 않음. nullptr이면 캡처하지 않음.
+     */
+    void setCaptureManager(CaptureManager* captureManager) { captureManager_ = captureManager; }
+
     SDL_Renderer* getRenderer() const { return renderer_; }
     SDL_Window* getWindow() const { return window_; }
+    /* 윈도우 없이 오프스크린 렌더러(SDL_CreateSoftwareRenderer 등)로 만든 경우 렌더 출력 크기를 사용함. */
     int getWindowWidth() const {
-        int w, h;
-        SDL_GetWindowSize(window_, &w, &h);
+        int w = 0, h = 0;
+        getOutputSize(w, h);
         return w;
     }
     int getWindowHeight() const {
-        int w, h;
-        SDL_GetWindowSize(window_, &w, &h);
+        int w = 0, h = 0;
+        getOutputSize(w, h);
         return h;
     }
+    void getOutputSize(int& w, int& h) const {
+        if (window_) {
+            SDL_GetWindowSize(window_, &w, &h);
+        } else if (renderer_) {
+            SDL_GetCurrentRenderOutputSize(renderer_, &w, &h);
+        }
+    }
     
    /* If you use this in a Scene, call it inside onEnter. */
     void setBackgroundColor(SDL_Color color) { backgroundColor = color; }
@@ -45,10 +127,108 @@ public:
     float getCameraY() const { return cameraY_; }
     void setZoomLevel(float zoom) { zoomLevel_ = zoom; }
     float getZoomLevel() const { return zoomLevel_; }
+
+    /*
+     * @brief 화면의 일부 영역(viewport)에 카메라 하나의 시점으로 그리기 시작함. 분할 화면, 미니맵 등에서 사용함.
+     *        endCameraView 전까지 월드 좌표는 viewport 중심을 카메라 위치로 보고 변환되며, viewport 밖은 잘림.
+     * @param viewport 렌더 출력 기준 픽셀 영역.
+     * @param cameraX, cameraY, zoom 이 뷰에서 사용할 카메라 상태.
+     */
+    void beginCameraView(const SDL_Rect& viewport, float cameraX, float cameraY, float zoom);
+    /* 카메라 뷰를 끝내고 이전 뷰포트와 카메라 상태를 복구함. */
+    void endCameraView();
+    bool isInCameraView() const { return isInCameraView_; }
+
+    /* 현재 월드 공간 렌더링 영역의 크기. 카메라 뷰 중이면 뷰포트 크기, 아니면 윈도우 크기임. */
+    int getViewWidth() const { return isInCameraView_ ? viewWidth_ : getWindowWidth(); }
+    int getViewHeight() const { return isInCameraView_ ? viewHeight_ : getWindowHeight(); }
+
+    /*
+     * @brief 월드 공간 렌더링 대상을 오프스크린 텍스처로 바꿈.
+     *        패스가 끝날 때까지 renderTexture는 originX, originY를 텍스처의 (0, 0)으로 보고 현재 줌을 적용함.
+     * @param target SDL_TEXTUREACCESS_TARGET으로 만든 텍스처.
+     * @param originX, originY 텍스처 좌상단에 대응하는 월드 좌표.
+     * @return 렌더 타겟 전환 성공 여부.
+     */
+    bool beginOffscreenPass(SDL_Texture* target, float originX, float originY);
+    /* 오프스크린 패스를 끝내고 이전 렌더 타겟을 복구함. */
+    void endOffscreenPass();
+    bool isInOffscreenPass() const { return passTarget_ != nullptr; }
+
+    /*
+     * @brief 이후의 드로우(renderTexture, drawSprite, drawQuads, fillRect, 카메라 뷰 등)를 SDL 대신 list에 기록함.
+     *        좌표 변환은 기록 시점의 카메라 상태로 끝내 두므로, execute는 카메라와 무관하게 같은 화면을 그림.
+     *        오프스크린 패스 안의 드로우는 타겟 텍스처를 바로 채워야 하므로 기록하지 않음.
+     */
+    void beginRecording(RenderCommandList* list) { recordList_ = list; }
+    void endRecording() { recordList_ = nullptr; }
+    bool isRecording() const { return recordList_ != nullptr; }
+
+    /*
+     * 명령 목록을 실행하는 백엔드. 스프라이트는 배치(또는 래스터라이저)로, 나머지는 SDL 렌더러로 보냄.
+     * 끝나면 배치를 비우므로, 이후에는 목록이 가리키던 텍스처를 파괴해도 됨.
+     */
+    void execute(const RenderCommandList& list);
+
+    /* 월드 좌표를 현재 렌더 타겟의 픽셀 좌표로 변환함. 오프스크린 패스 중이면 패스 원점을 기준으로 함. */
+    void worldToScreen(float worldX, float worldY, float& outScreenX, float& outScreenY) const;
+
+    /*
+     * @brief 렌더 타겟 픽셀 좌표의 쿼드를 스프라이트 배치에 추가함. 카메라 변환을 하지 않음.
+     *        텍스트 글리프처럼 이미 배치된 쿼드를 그릴 때 사용함.
+     */
+    void drawSprite(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect,
+                    SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE) {
+        if (recordList_) {
+            recordList_->drawSprite(texture, srcRect, dstRect, color, flip);
+        } else {
+            spriteBatch_.draw(texture, srcRect, dstRect, color, flip);
+        }
+    }
+
+    /* drawSprite의 회전 버전. originX, originY는 렌더 타겟 픽셀 좌표의 회전 중심임. */
+    void drawSpriteRotated(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, float sinAngle, float cosAngle,
+                           float originX, float originY, SDL_FColor color = {1.0f, 1.0f, 1.0f, 1.0f}, SDL_FlipMode flip = SDL_FLIP_NONE) {
+        if (recordList_) {
+            recordList_->drawSpriteRotated(texture, srcRect, dstRect, sinAngle, cosAngle, originX, originY, color, flip);
+        } else {
+            spriteBatch_.drawRotated(texture, srcRect, dstRect, sinAngle, cosAngle, originX, originY, color, flip);
+        }
+    }
+
+    /*
+     * @brief SpriteBatch::drawQuads로 쿼드 정점을 그림. 카메라 변환을 하지 않음. 래스터라이저가 있으면 래스터라이저로 감.
+     *        기록 중이면 정점을 복사해 GEOMETRY 명령으로 남김.
+     * @param blendMode(SDL_BLENDMODE_INVALID) 이 쿼드를 그리는 동안만 텍스처(텍스처가 없으면 렌더러 드로우)에 쓸 블렌드 모드.
+     *        SDL_BLENDMODE_INVALID면 바꾸지 않음.
+     */
+    void drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount, SDL_BlendMode blendMode = SDL_BLENDMODE_INVALID);
+
+    /* 렌더 타겟 픽셀 좌표의 사각형을 현재 드로우 블렌드 모드로 칠함. 텍스처 없는 쿼드로 배치에 넣으므로 래스터라이저에도 그려짐. */
+    void fillRect(const SDL_FRect& rect, SDL_FColor color);
+    /* 이후 fillRect의 블렌드 모드. */
+    void setDrawBlendMode(SDL_BlendMode blendMode);
+
+    /* 배치된 스프라이트를 그림. 렌더러에 직접 그리기 전이나 블렌드 모드를 바꾸기 전에 호출해야 함. 기록 중에는 아무것도 하지 않음. */
+    void flushSprites() {
+        if (!recordList_) {
+            spriteBatch_.flush();
+        }
+    }
+    SpriteBatch& getSpriteBatch() { return spriteBatch_; }
     
+
     /* 텍스처를 화면에 그리는 함수 */
     void renderTexture(Texture* texture, float x, float y, float w, float h, SDL_FlipMode flip = SDL_FLIP_NONE);
     void renderTexture(Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h, SDL_FlipMode flip = SDL_FLIP_NONE);
         void renderTexture(SDL_Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h, SDL_FlipMode flip = SDL_FLIP_NONE);
     void renderUITexture(SDL_Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h, SDL_FlipMode flip = SDL_FLIP_NONE);
+
+    /*
+     * @brief 회전된 텍스처를 월드 공간에 그림. x, y는 기준점(pivot)의 월드 좌표이며, 회전도 기준점을 중심으로 함.
+     * @param sinAngle, cosAngle 회전각의 sin/cos. 호출자가 FastMath::sinCosDegrees로 미리 구함.
+     * @param pivotX, pivotY 스프라이트 크기에 대한 기준점 비율. (0.5, 0.5)면 renderTexture와 같은 위치임.
+     */
+    void renderTextureRotated(SDL_Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h,
+                              float sinAngle, float cosAngle, float pivotX = 0.5f, float pivotY = 0.5f, SDL_FlipMode flip = SDL_FLIP_NONE);
 };
\ No newline at end of file
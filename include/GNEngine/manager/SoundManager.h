@@ -9,12 +9,18 @@
 #include <vector>
 #include <memory>
 #include <optional>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "GNEngine/core/Entity.h"
 #include "GNEngine/core/Sound.h"
+#include "GNEngine/core/SoundStream.h"
 
 #define AL_CHECK_ERROR() checkAlErrors(__FILE__, __LINE__)
 
+class JobManager;
+
 struct Position {
     float x, y, z;
 };
@@ -26,6 +32,18 @@ enum class SoundPriority {
     CRITICAL
 };
 
+/* SoundManager::getCacheStats가 돌려주는 사운드 캐시 상태 */
+struct SoundCacheStats {
+    size_t residentBytes = 0;  /* 올라가 있는 디코딩된 PCM 합계 */
+    size_t budgetBytes = 0;    /* 0이면 한도 없음 */
+    size_t cachedCount = 0;    /* 캐시에 있는 사운드 수(내려간 것 포함) */
+    size_t residentCount = 0;
+    size_t pinnedCount = 0;
+    uint64_t hits = 0;         /* 요청한 사운드가 이미 올라가 있던 횟수 */
+    uint64_t misses = 0;       /* 디코딩이 필요했던 횟수(처음 로드와 다시 올리기) */
+    uint64_t evictions = 0;
+};
+
 class GNEngine_API SoundManager {
 public:
     SoundManager();
@@ -34,8 +52,52 @@ public:
     bool initAL();
     void quitAL();
 
+    /*
+     * @brief 사운드를 동기로 불러옴. 이미 캐시에 있으면 그대로 돌려줌.
+     *        loadSoundAsync로 로딩 중인 경로라면 아직 READY가 아닌 핸들이 돌아올 수 있음.
+     */
     std::shared_ptr<Sound> getSound(const std::filesystem::path& filePath);
 
+    /*
+     * @brief 디코딩을 jobManager 워커에 맡기고 로딩 중(LOADING) 핸들을 바로 돌려줌. 여러 파일을 부르면 병렬로 디코딩됨.
+     *        OpenAL 버퍼 업로드는 uploadPendingSounds를 부르는 스레드(보통 SoundSystem이 도는 메인 스레드)에서 함.
+     *        LOADING 상태의 Sound로 playSound를 부르면 0을 돌려주고, SoundComponent::play는 준비될 때까지 대기함.
+     * @return 지원하지 않는 형식이면 nullptr. 디코딩 실패는 핸들의 isFailed()로 알 수 있음.
+     */
+    std::shared_ptr<Sound> loadSoundAsync(const std::filesystem::path& filePath, JobManager& jobManager);
+
+    /*
+     * @brief 씬 매니페스트 등 여러 파일을 jobManager에서 병렬로 디코딩하고, 끝나면 호출한 스레드에서 모두 업로드함.
+     *        로딩 화면처럼 기다려도 되는 곳에서 씀.
+     * @return 모두 성공하면 true.
+     */
+    bool preloadSounds(const std::vector<std::filesystem::path>& filePaths, JobManager& jobManager);
+
+    /* 디코딩이 끝난 비동기 사운드를 OpenAL 버퍼로 올림. 소유 스레드에서 매 프레임 부름(SoundSystem::update). */
+    void uploadPendingSounds();
+
+    /*
+     * @brief 디코딩된 PCM의 총 크기 한도를 정함. 넘으면 보이스에 물려 있지 않고 고정되지 않은 사운드를
+     *        가장 오래전에 재생한 것부터 내림. 한도 안에 들일 수 없으면 넘는 것을 허용함.
+     *        캐시만 가진 사운드는 지우고, SoundComponent 등이 핸들을 들고 있으면 버퍼만 내려 EVICTED로 둠.
+     *        EVICTED 사운드는 다음 재생 요청 때 jobManager가 있으면 비동기로, 없으면 그 자리에서 다시 불러옴.
+     * @param budgetBytes 0이면 한도 없음(기본값).
+     */
+    void setMemoryBudget(size_t budgetBytes, JobManager* jobManager = nullptr);
+    size_t getMemoryBudget() const { return memoryBudget_; }
+
+    /* 고정한 사운드는 한도를 넘어도 내리지 않음. 이미 내려간 사운드를 고정하면 다시 불러옴. */
+    void pinSound(const std::shared_ptr<Sound>& sound, bool isPinned = true);
+
+    /*
+     * @brief 재생 전에 사운드가 올라가 있게 함. EVICTED면 다시 불러오기를 시작함.
+     * @return 지금 재생할 수 있으면 true. 로딩 중이거나 실패했으면 false.
+     */
+    bool prepareSound(Sound* sound);
+
+    SoundCacheStats getCacheStats() const;
+    void resetCacheStats();
+
     ALuint playSound(EntityID entityId, Sound* sound,
                      Position position = {0.0f, 0.0f, 0.0f},
                      SoundPriority priority = SoundPriority::NORMAL,
@@ -57,11 +119,36 @@ public:
     void setSourceVolume(ALuint sourceId, float volume);
     void setSourcePitch(ALuint sourceId, float pitch);
 
+    /*
+     * @brief 긴 음악 파일을 스트리밍 음원으로 엶. 캐시하지 않으며, 부를 때마다 디코더와 소스를 새로 만듦.
+     *        처음 열 때 스트리밍 스레드를 시작함. 재생은 반환된 SoundStream의 play로 함.
+     * @return 파일을 열지 못하면 nullptr.
+     */
+    std::shared_ptr<SoundStream> openStream(const std::filesystem::path& filePath);
+    void stopAllStreams();
+
+    /* 재생이 끝나 syncVoices에서 반납된 보이스. 반납 전의 소스 ID와 주인을 담음 */
+    struct FinishedVoice {
+        ALuint sourceId;
+        EntityID ownerEntityId;
+    };
+
+    /*
+     * @brief 프레임마다 한 번 부르는 보이스 상태 동기화. 재생이 끝난 보이스를 반납하고 getFinishedVoices에 모음.
+     *        AL_SOFT_events를 쓸 수 있으면 드라이버가 알려 준 소스만 확인하고, 없으면 사용 중인 보이스만 한 번씩 조회함.
+     *        어느 쪽이든 비용은 풀 크기가 아니라 사용 중이거나 끝난 보이스 수에 비례함.
+     */
+    void syncVoices();
+    const std::vector<FinishedVoice>& getFinishedVoices() const { return finishedVoices_; }
+
     // --- SoundSystem이 SoA 데이터에 접근하기 위한 Getter 함수들 ---
     const std::vector<ALuint>& getSourceIds() const { return sourceIdsLeft_; }
     const std::vector<EntityID>& getOwnerEntityIds() const { return ownerEntityIds_; }
     const std::vector<bool>& getArePlayingFlags() const { return arePlaying_; }
+    /* 사용 중인 보이스 인덱스. 순서는 보장하지 않음 */
+    const std::vector<uint32_t>& getActiveVoices() const { return activeVoices_; }
     size_t getVoiceCount() const { return sourceIdsLeft_.size(); }
+    bool isUsingSourceEvents() const { return isUsingSourceEvents_; }
     
     /* 최대 보이스 풀 개수*/
     static constexpr int MAX_VOICES = 64;
@@ -85,16 +172,103 @@ private:
     // 빠른 조회를 위한 소스 ID -> 인덱스 맵
     std::unordered_map<ALuint, size_t> sourceIdToIndexMap_;
 
-    std::optional<size_t> findAvailableVoice(SoundPriority priority);
+    // --- Voice allocation ---
+    /* 훔칠 보이스 후보. (우선순위, 시작 순서)가 가장 작은 것이 힙의 맨 위임 */
+    struct StealCandidate {
+        SoundPriority priority;
+        uint64_t sequence;
+        uint32_t voice;
+    };
+    std::vector<uint32_t> freeVoices_;      /* 비어 있는 보이스 스택. 획득/반납 O(1) */
+    std::vector<uint32_t> activeVoices_;    /* 사용 중인 보이스. 반납은 맨 뒤와 바꿔 지움 */
+    std::vector<uint32_t> activeSlots_;     /* 보이스 -> activeVoices_ 안의 위치 */
+    std::vector<uint64_t> voiceSequences_;  /* 보이스를 잡은 순서. 0이면 비어 있음. 힙의 낡은 항목을 거르는 데 씀 */
+    std::vector<StealCandidate> stealHeap_; /* 반납된 보이스의 항목은 지우지 않고 꺼낼 때 거름 */
+    uint64_t nextSequence_ = 1;
+    std::vector<FinishedVoice> finishedVoices_;
+    static bool isLaterStealCandidate(const StealCandidate& a, const StealCandidate& b);
+
+    // --- AL_SOFT_events ---
+    /* 믹서 스레드에서 불리는 콜백이 멈춘 소스 ID를 넣고, syncVoices가 비움 */
+    std::vector<ALuint> stoppedSources_;
+    std::vector<ALuint> stoppedSourcesScratch_;
+    std::mutex stoppedSourcesMutex_;
+    bool isUsingSourceEvents_ = false;
+
+    bool enableSourceEvents();
+    void disableSourceEvents();
+    static void AL_APIENTRY onSourceEvent(ALenum eventType, ALuint object, ALuint param, ALsizei length, const ALchar* message, void* userParam) noexcept;
+    void retireIfStopped(size_t voiceIndex);
+
+    /* 디코딩된 PCM. 스테레오는 공간화를 위해 좌우 채널을 나눠 둠. 워커 스레드에서 만들 수 있음 */
+    struct DecodedSound {
+        std::vector<short> left;  /* 모노면 여기에만 채움 */
+        std::vector<short> right;
+        unsigned int sampleRate = 0;
+        bool isStereo = false;
+    };
+
+    struct PendingUpload {
+        std::shared_ptr<Sound> sound;
+        std::filesystem::path path;
+        DecodedSound pcm;
+        bool isDecoded = false;
+    };
+
+    // --- Cache budget ---
+    size_t memoryBudget_ = 0;
+    size_t residentBytes_ = 0;
+    uint64_t cacheClock_ = 0;
+    uint64_t cacheHits_ = 0;
+    uint64_t cacheMisses_ = 0;
+    uint64_t cacheEvictions_ = 0;
+    JobManager* reloadJobManager_ = nullptr;
+
+    /* 새 PCM을 올리기 전에 incomingBytes가 들어갈 자리를 만듦 */
+    void evictSounds(size_t incomingBytes);
+    /* 버퍼를 올린 사운드를 캐시 통계와 LRU에 넣음 */
+    void markResident(Sound& sound, const std::filesystem::path& filePath, size_t byteSize);
+    void reloadSound(const std::shared_ptr<Sound>& sound, JobManager* jobManager);
+    void submitDecode(const std::shared_ptr<Sound>& sound, const std::filesystem::path& filePath, JobManager& jobManager);
+    static size_t getByteSize(const DecodedSound& pcm) { return (pcm.left.size() + pcm.right.size()) * sizeof(short); }
+
+    // --- Async loading ---
+    std::vector<PendingUpload> decodedSounds_; /* 워커가 채우고 uploadPendingSounds가 비움 */
+    std::mutex pendingMutex_;
+    std::condition_variable pendingIdle_;
+    size_t pendingDecodeCount_ = 0; /* 아직 끝나지 않은 디코딩 작업 수. quitAL에서 0이 될 때까지 기다림 */
+
+    // --- Streaming ---
+    /* 스트리밍 스레드가 버퍼를 다시 채우는 주기. 버퍼 하나(약 93ms)보다 충분히 짧아야 함 */
+    static constexpr int STREAM_UPDATE_INTERVAL_MS = 10;
+    std::vector<std::weak_ptr<SoundStream>> streams_;
+    std::mutex streamMutex_;
+    std::condition_variable streamCondition_;
+    std::thread streamThread_;
+    bool isStreamThreadRunning_ = false;
+
+    void streamThreadLoop();
+    void stopStreamThread();
+
+    std::optional<size_t> acquireVoice(SoundPriority priority);
+    void activateVoice(size_t voiceIndex, SoundPriority priority);
     void releaseVoice(size_t voiceIndex);
 
     void checkAlErrors(const std::string& filename, int line);
 
-    // Load files. (Decode sound file -> PCM Data)
-    bool loadWav(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo);
-    bool loadMp3(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo);
-    bool loadFlac(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo);
-    bool loadOgg(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo);
+    // Decode files. (Decode sound file -> PCM Data). AL을 건드리지 않으므로 워커 스레드에서 불러도 됨
+    static bool isSupportedFormat(const std::filesystem::path& filePath);
+    /* 디코딩 스레드마다 하나씩 두고 재사용하는 PCM 버퍼. 그 스레드에서 가장 컸던 소리만큼의 용량을 계속 들고 있음 */
+    static DecodedSound& getDecodeScratch();
+    static bool decodeSound(const std::filesystem::path& filePath, DecodedSound& out);
+    static bool decodeWav(const std::filesystem::path& filePath, DecodedSound& out);
+    static bool decodeMp3(const std::filesystem::path& filePath, DecodedSound& out);
+    static bool decodeFlac(const std::filesystem::path& filePath, DecodedSound& out);
+    static bool decodeOgg(const std::filesystem::path& filePath, DecodedSound& out);
+    static void splitStereo(const short* interleaved, size_t frameCount, DecodedSound& out);
+
+    // Upload PCM -> OpenAL buffers. 소유 스레드에서만 부름
+    bool uploadSound(const DecodedSound& pcm, ALuint& monoBuffer, ALuint& stereoBufferRight);
 };
 
 
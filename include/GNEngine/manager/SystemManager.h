@@ -32,15 +32,17 @@ public:
      * @brief 시스템을 특정 실행 단계에 등록함.
      * @tparam T 등록할 시스템의 타입.
      * @param phase 시스템이 속할 실행 단계.
+     * @return 등록된 시스템. 등록 후 시스템 설정이 필요할 때 사용함.
      */
     template<typename T, typename... Args>
-    void registerSystem(SystemPhase phase, Args&&... args) {
+    std::shared_ptr<T> registerSystem(SystemPhase phase, Args&&... args) {
         auto system = std::make_shared<T>(std::forward<Args>(args)...);
         systems_[phase].push_back(
             [this, system](float deltaTime) {
                 system->update(entityManager_, deltaTime);
             }
         );
+        return system;
     }
 
     /**
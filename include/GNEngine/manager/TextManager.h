@@ -5,18 +5,36 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include <string>
 #include <map>
+#include <list>
 #include <memory>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <format>
 #include <functional> // For std::hash<std::filesystem::path> (if using unordered_map)
+#include <utility>
+
+#include "GNEngine/core/GlyphAtlas.h"
+#include "GNEngine/core/FontFace.h"
+
+/* 폰트 캐시 통계 */
+struct FontCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t fileLoads = 0;   /* 디스크에서 폰트 파일을 읽은 횟수 */
+    size_t cachedFaces = 0;
+};
 
 /*
  * @brief 폰트를 로드하고 Text 객체를 생성 및 관리하는 클래스.
+ *        폰트는 (경로, 포인트 크기, 스타일)을 키로 FontFace 단위로 캐시하며, 같은 파일의 페이스들은 파일 내용을 공유함.
+ *        캐시가 maxCachedFaces를 넘으면 가장 오래 쓰이지 않은 페이스 중 외부에서 잡고 있지 않은 것부터 해제함.
 */ 
 class GNEngine_API TextManager {
 public:
+    static constexpr size_t DEFAULT_MAX_CACHED_FACES = 32;
+
     /*
      * @brief TextManager를 초기화함.
      * @param renderer 이미 SDL_CreateRenderer()로 생성을 마친 SDL_Renderer의 포인터 주소값.
@@ -30,16 +48,17 @@ public:
 
     /*
      * @brief 지정된 경로와 크기로 폰트를 로드함.
-     * @param filePath 폰트 파일 경로 (폰트의 고유 ID로 사용됨)
+     * @param filePath 폰트 파일 경로
      * @param fontPointSize 폰트 크기 (포인트 단위)
      * @return 성공 시 true, 실패 시 false
      */
     bool loadFont(const std::filesystem::path& filePath, int fontPointSize);
 
     /*
-     * @brief 폰트 크기를 Point 단위로 변경함.
-     * @param filePath 폰트 파일 경로 (폰트의 고유 ID로 사용됨)
-     * @param sizePoint 변경할 폰트 크기 (포인트 단위)
+     * @brief 해당 크기의 폰트 페이스를 미리 로드함.
+     *        예전처럼 공유 폰트의 크기를 바꾸지 않음. 크기별 페이스는 서로 독립적임.
+     * @param filePath 폰트 파일 경로
+     * @param sizePoint 로드할 폰트 크기 (포인트 단위)
      * @return 성공 시 true, 실패 시 false
      */
     bool setFontSizePt(const std::filesystem::path& filePath, int fontPointSize);
@@ -51,11 +70,61 @@ public:
     */
     std::string loadTextFromFile(const std::filesystem::path& filePath);
 
-    TTF_Font* getFont(const std::filesystem::path& filePath, int fontPointSize);
+    /*
+     * @brief (경로, 크기, 스타일)에 맞는 폰트 페이스를 반환함. 캐시에 없으면 로드함.
+     *        반환된 shared_ptr을 들고 있는 동안 페이스는 캐시에서 해제되지 않음.
+     * @return 로드 실패 시 nullptr.
+     */
+    std::shared_ptr<FontFace> getFontFace(const std::filesystem::path& filePath, int fontPointSize, int style = TTF_STYLE_NORMAL);
+
+    /*
+     * @brief getFontFace의 TTF_Font*만 반환함.
+     *        포인터는 페이스가 캐시에서 해제되기 전까지만 유효하므로 오래 보관하려면 getFontFace를 사용해야 함.
+     */
+    TTF_Font* getFont(const std::filesystem::path& filePath, int fontPointSize, int style = TTF_STYLE_NORMAL);
+
+    /*
+     * @brief (폰트 파일, 크기)에 해당하는 글리프 아틀라스를 반환함. 없으면 해당 크기의 페이스로 새로 만듦.
+     * @return 폰트를 열 수 없으면 nullptr.
+     */
+    GlyphAtlas* getGlyphAtlas(const std::filesystem::path& filePath, int fontPointSize);
+
+    void setMaxCachedFaces(size_t maxFaces) { maxCachedFaces_ = maxFaces; evictUnused(); }
+    FontCacheStats getCacheStats() const;
 
 private:
+    struct FontKey {
+        std::filesystem::path path;
+        int pointSize;
+        int style;
+        bool operator<(const FontKey& other) const {
+            if (pointSize != other.pointSize) return pointSize < other.pointSize;
+            if (style != other.style) return style < other.style;
+            return path < other.path;
+        }
+    };
+
+    struct FaceEntry {
+        std::shared_ptr<FontFace> face;
+        std::list<FontKey>::iterator lruIt;
+    };
+
+    /* 아틀라스는 자기 페이스를 잡고 있으므로, 아틀라스가 있는 동안 페이스는 해제되지 않음. */
+    struct AtlasEntry {
+        std::shared_ptr<FontFace> face;
+        std::unique_ptr<GlyphAtlas> atlas;
+    };
+
+    std::shared_ptr<const FontFileData> loadFontFile(const std::filesystem::path& filePath);
+    void evictUnused();
+
     SDL_Renderer* renderer_;
-    std::map<std::filesystem::path, TTF_Font*> fontMap_;
+    size_t maxCachedFaces_ = DEFAULT_MAX_CACHED_FACES;
+    std::map<FontKey, FaceEntry> faces_;
+    std::list<FontKey> lru_; /* 앞쪽이 가장 최근에 쓰인 페이스 */
+    std::map<std::filesystem::path, std::weak_ptr<const FontFileData>> fontFiles_;
+    std::map<std::pair<std::filesystem::path, int>, AtlasEntry> glyphAtlases_;
+    FontCacheStats stats_;
 };
 
 
@@ -9,11 +9,67 @@
 #include <memory>
 #include <filesystem>
 #include <functional> // Required for std::hash<std::filesystem::path>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
 
 #include "GNEngine/core/Texture.h"
 
+class JobManager;
+
+/*
+ * @class TextureManager
+ * @brief 파일/내장 이미지를 텍스처로 불러와 보관하는 매니저임.
+ *        불러올 때 한 번, 렌더러가 선호하는 픽셀 포맷으로 변환하고 알파를 미리 곱한 뒤 SDL_BLENDMODE_BLEND_PREMULTIPLIED로 설정함.
+ *        따라서 이 텍스처를 정점 색으로 반투명하게 그릴 때는 정점 색의 rgb에도 알파를 곱해야 함(isPremultiplied로 확인).
+ */
 class GNEngine_API TextureManager {
+public:
+    /* 프리멀티플라이드 알파로 불러온 텍스처에 붙는 SDL 텍스처 속성 이름 */
+    static constexpr const char* PREMULTIPLIED_PROPERTY = "GNEngine.texture.premultiplied";
+
+    /* 축소본을 만들 때의 필터. BOX는 블록 전체 평균, BILINEAR는 블록 중심의 2x2 평균으로 더 빠르지만 거칠음. */
+    enum class ScaleFilter { BOX, BILINEAR };
+
+    static constexpr int MAX_VARIANT_LEVEL = 4; /* 1/2 ~ 1/16 배율까지 축소본을 만듦 */
+
 private:
+    /* 축소본을 만들기 위해 보관하는 원본 픽셀. 프리멀티플라이드 알파 ARGB8888임. */
+    struct SourceImage {
+        int width = 0;
+        int height = 0;
+        std::vector<uint32_t> pixels;
+    };
+
+    /* 작업 스레드가 만든 축소본 픽셀. 텍스처 생성은 렌더러 스레드에서 해야 하므로 큐로 넘김. */
+    struct BuiltVariant {
+        SDL_Texture* source;
+        int level;
+        int width;
+        int height;
+        std::vector<uint32_t> pixels;
+    };
+
+    struct VariantQueue {
+        std::mutex mutex;
+        std::vector<BuiltVariant> built;
+        std::atomic<size_t> readyCount{0};
+    };
+
+    struct Variant {
+        SDL_Texture* texture = nullptr;
+        bool isPending = false;
+        uint64_t lastUsed = 0;
+        size_t bytes = 0;
+    };
+
+    struct VariantSet {
+        std::shared_ptr<const SourceImage> source;
+        std::array<Variant, MAX_VARIANT_LEVEL + 1> levels; /* 0번은 쓰지 않음(원본) */
+    };
+
     SDL_Renderer* renderer_;
 
     /* 파일 경로 기반 텍스처 저장소 */
@@ -23,6 +79,32 @@ private:
     std::unique_ptr<Texture> defaultTexture_;
     std::unique_ptr<Texture> imageErrorTexture_;
 
+    /* 축소본 캐시 상태 */
+    bool isVariantEnabled_ = false;
+    JobManager* variantJobs_ = nullptr;
+    ScaleFilter variantFilter_ = ScaleFilter::BOX;
+    size_t variantBudget_ = 0;
+    size_t variantMemory_ = 0;
+    uint64_t variantUseTick_ = 0;
+    std::unordered_map<SDL_Texture*, VariantSet> variantSets_;
+    std::shared_ptr<VariantQueue> variantQueue_ = std::make_shared<VariantQueue>();
+    std::vector<SDL_Texture*> retiredVariants_; /* 이번 프레임에 기록된 명령이 아직 쓸 수 있어 present 뒤에 파괴할 축소본 */
+
+    /* 불러올 때의 포맷 변환 */
+    SDL_PixelFormat preferredFormat_ = SDL_PIXELFORMAT_ARGB8888;
+    std::atomic<uint64_t> conversionCount_{0};
+    std::atomic<uint64_t> conversionTimeNs_{0};
+
+    SDL_Surface* prepareSurface(SDL_Surface* surface, const std::string& name);
+    bool addTextureFromSurface(const std::filesystem::path& key, SDL_Surface* surface);
+
+    void keepVariantSource(SDL_Texture* texture, SDL_Surface* surface);
+    void requestVariant(SDL_Texture* texture, VariantSet& set, int level);
+    void uploadReadyVariants();
+    void addVariant(const BuiltVariant& built);
+    void evictVariants(size_t incomingBytes);
+    static BuiltVariant buildVariant(const SourceImage& source, SDL_Texture* texture, int level, ScaleFilter filter);
+
 public:
     TextureManager(SDL_Renderer* renderer);
     ~TextureManager();
@@ -34,6 +116,12 @@ public:
     */
     bool loadTexture(const std::filesystem::path& filePath);
 
+    /**
+    * @brief 여러 파일의 디코딩과 포맷 변환을 jobManager에서 병렬로 하고 텍스처를 만듦. 씬 시작 전 미리 불러오기용.
+    * @return 모두 성공하면 true.
+    */
+    bool preloadTextures(const std::vector<std::filesystem::path>& filePaths, JobManager& jobManager);
+
     /**
     * @brief 내장된 메모리에서 텍스처를 로드함.
     * @param name 텍스처를 식별할 고유 이름.
@@ -57,6 +145,46 @@ public:
     */
     Texture* getEmbeddedTexture(const std::string& name);
 
+    /*
+     * @brief 이 매니저가 가진 텍스처를 다시 찾을 키를 돌려줌. 렌더 명령 덤프의 텍스처 표에 쓰임.
+     *        불러온 텍스처는 getTexture/getEmbeddedTexture에 넘긴 경로나 이름, 축소본은 "원본 키#단계"(1/2^단계 배율)이며 모르는 텍스처는 빈 문자열임.
+     *        모든 텍스처를 훑으므로 매 프레임 부르지 말 것.
+     */
+    std::string getTextureKey(SDL_Texture* texture) const;
+
     void setScaleModeOfTexture(const std::string& name, SDL_ScaleMode scaleMode);
     void setScaleModeOfTexture(const std::filesystem::path& name, SDL_ScaleMode scaleMode);
+
+    /*
+     * @brief 축소 렌더링용 텍스처 축소본 캐시를 켬. 켠 뒤에 loadTexture로 불러온 텍스처만 대상이며, 원본 픽셀을 메모리에 보관함.
+     *        축소본은 카메라가 실제로 요청한 배율(1/2, 1/4, ... 1/16)만 만들어짐.
+     * @param jobManager 축소본을 만들 스레드 풀. nullptr이면 처음 요청한 프레임에 바로 만듦.
+     * @param memoryBudgetBytes 축소본 텍스처의 총 크기 한도. 넘으면 가장 오래 쓰지 않은 축소본부터 해제함.
+     * @param filter(ScaleFilter::BOX) 축소 필터.
+     */
+    void enableScaledVariants(JobManager* jobManager, size_t memoryBudgetBytes, ScaleFilter filter = ScaleFilter::BOX);
+    void disableScaledVariants();
+    bool isScaledVariantEnabled() const { return isVariantEnabled_; }
+
+    /*
+     * @brief scale 배율로 그릴 때 쓸 축소본을 돌려줌. 축소본 크기가 그릴 크기 이상이 되도록 가장 가까운 단계를 고름.
+     *        아직 만들어지지 않았으면 만들기를 요청하고 원본을 돌려줌. 렌더러 스레드에서만 호출해야 함.
+     * @param outScaleX, outScaleY 돌려준 텍스처의 원본 대비 가로/세로 픽셀 배율. 소스 영역에 곱해서 씀. 원본이면 1.0.
+     */
+    SDL_Texture* getScaledVariant(SDL_Texture* texture, float scale, float& outScaleX, float& outScaleY);
+
+    size_t getVariantMemoryUsage() const { return variantMemory_; }
+
+    /*
+     * @brief 예산 때문에 내보낸 축소본 텍스처를 실제로 파괴함. 같은 프레임에 먼저 기록된 명령이 그 텍스처를 그릴 수 있으므로
+     *        RenderManager가 프레임의 드로우를 모두 렌더러에 넘긴 뒤(present) 호출함.
+     */
+    void releaseRetiredVariants();
+
+    /* TextureManager가 프리멀티플라이드 알파로 불러온 텍스처인지 확인함. */
+    static bool isPremultiplied(SDL_Texture* texture);
+    SDL_PixelFormat getPreferredFormat() const { return preferredFormat_; }
+    /* 불러올 때 포맷이 바뀐 텍스처 수와, 변환/프리멀티플라이에 쓴 누적 시간. */
+    uint64_t getConversionCount() const { return conversionCount_.load(); }
+    double getConversionTimeMs() const { return conversionTimeNs_.load() / 1.0e6; }
 };
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <vector>
+
+#include "GNEngine/manager/EntityManager.h"
+#include "GNEngine/component/AnimationStateMachineComponent.h"
+#include "GNEngine/component/AnimationComponent.h"
+#include "GNEngine/component/RenderComponent.h"
+#include "GNEngine/component/VelocityComponent.h"
+#include "GNEngine/component/AccelerationComponent.h"
+
+/*
+ * @class AnimationStateMachineSystem
+ * @brief AnimationStateMachineComponent를 가진 모든 엔티티의 상태 전환을 평가하는 시스템임.
+ *        1단계에서 컴포넌트 SoA 컬럼을 순서대로 돌며 바인딩된 파라미터를 채우고 전환을 평가해 바뀐 인덱스만 모음.
+ *        2단계에서 모은 엔티티만 AnimationComponent의 클립과 RenderComponent의 텍스처/소스 영역을 바꿈.
+ *        상태가 그대로인 엔티티는 다른 컴포넌트 배열을 건드리지 않음. AnimationSystem보다 먼저 실행되어야 함.
+ */
+class GNEngine_API AnimationStateMachineSystem {
+public:
+    AnimationStateMachineSystem() = default;
+
+    /*
+     * @brief 모든 상태 머신을 평가하고 전환된 엔티티의 애니메이션을 바꿈. 이번 프레임의 이벤트는 평가 후 지워짐.
+     * @param entityManager - 엔티티와 컴포넌트를 관리하는 EntityManager.
+     * @param deltaTime - 이전 프레임으로부터 경과된 시간 (초).
+     */
+    void update(EntityManager& entityManager, float deltaTime);
+
+private:
+    /* ParameterSource가 있는 파라미터를 Velocity/Acceleration 컬럼에서 채움. 해당 컴포넌트가 없으면 0. */
+    void fillBoundParameters(ComponentArray<VelocityComponent>* velocityArray, ComponentArray<AccelerationComponent>* accelerationArray,
+                             ComponentArray<AnimationStateMachineComponent>& machineArray, size_t index);
+    void applyState(ComponentArray<AnimationComponent>* animArray, ComponentArray<RenderComponent>* renderArray, EntityID entity, const AnimationStateMachine::State& state);
+
+    std::vector<size_t> transitioned_; /* 이번 프레임에 상태가 바뀐 SoA 인덱스. 프레임마다 재사용함 */
+};
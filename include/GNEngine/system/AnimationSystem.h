@@ -10,6 +10,10 @@
 /*
  * @class AnimationSystem
  * @brief AnimationComponent를 가진 모든 엔티티의 애니메이션 프레임을 업데이트하는 시스템임.
+ *        프레임 지속 시간은 AnimationTable의 평탄한 표에서, 재생 상태는 컴포넌트 SoA 컬럼에서 읽음.
+ *        AnimationLod가 FULL이 아닌 엔티티는 갱신을 건너뛰고 시간을 쌓아 두었다가 갱신할 차례나 다시 보일 때 한 번에 따라잡음.
+ *        프레임 이벤트는 update마다 연속된 버퍼 하나에 (엔티티, 이벤트) 쌍으로 모으며, 다음 update 전까지 getEvents로 읽을 수 있음.
+ *        한 번에 여러 프레임을 넘어가도 지나친 프레임의 이벤트를 모두 순서대로 넣음.
 */
 class GNEngine_API AnimationSystem {
 public:
@@ -21,6 +25,20 @@ public:
      * @param deltaTime - 이전 프레임으로부터 경과된 시간 (초).
      */
     void update(EntityManager& entityManager, float deltaTime);
+
+    /* AnimationLod::REDUCED 엔티티를 몇 프레임에 한 번 갱신할지 정함. 엔티티마다 차례를 엇갈려 부하를 나눔. */
+    void setReducedUpdateInterval(int frames) { reducedUpdateInterval_ = frames > 0 ? frames : 1; }
+    int getReducedUpdateInterval() const { return reducedUpdateInterval_; }
+
+    /* 마지막 update에서 발생한 프레임 이벤트. 엔티티 순서, 같은 엔티티 안에서는 발생 순서임. */
+    const std::vector<AnimationEvent>& getEvents() const { return events_; }
+    /* update마다 1씩 늘어나는 번호. 소비자가 같은 버퍼를 두 번 읽지 않도록 비교하는 데 쓰며, REDUCED 엔티티의 갱신 차례도 이 번호로 정함. */
+    uint64_t getEventFrame() const { return eventFrame_; }
+
+private:
+    std::vector<AnimationEvent> events_;
+    uint64_t eventFrame_ = 0;
+    int reducedUpdateInterval_ = 4;
 };
 
 
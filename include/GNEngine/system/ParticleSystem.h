@@ -0,0 +1,59 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+#include "GNEngine/manager/EntityManager.h"
+#include "GNEngine/manager/RenderManager.h"
+#include "GNEngine/component/ParticleEmitterComponent.h"
+#include "GNEngine/component/TransformComponent.h"
+#include "GNEngine/core/RenderLayer.h"
+
+/*
+ * @class ParticleSystem
+ * @brief ParticleEmitterComponent의 파티클을 방출, 시뮬레이션하고 이미터당 SDL_RenderGeometry 한 번으로 그리는 시스템임.
+ *        레이어별로 살아있는 파티클 수의 상한(budget)과 방출량 배율을 줄 수 있음.
+ *        그리기는 RenderSystem의 레이어 렌더러로 등록된 renderLayer에서 레이어 순서에 맞춰 수행함.
+ */
+class GNEngine_API ParticleSystem {
+public:
+    ParticleSystem(RenderManager& renderManager);
+
+    /*
+     * @brief 파티클 방출과 시뮬레이션을 수행함.
+     * @param entityManager - 엔티티와 컴포넌트를 관리하는 EntityManager.
+     * @param deltaTime - 이전 프레임으로부터 경과된 시간 (초).
+     */
+    void update(EntityManager& entityManager, float deltaTime);
+
+    /* layer에 속한 모든 이미터의 파티클을 그림. */
+    void renderLayer(EntityManager& entityManager, RenderLayer layer);
+
+    /* 레이어 전체에서 동시에 살아있을 수 있는 파티클 수. 기본값은 제한 없음. */
+    void setLayerBudget(RenderLayer layer, size_t maxParticles) { layerBudgets_[static_cast<size_t>(layer)] = maxParticles; }
+    /* 레이어에 속한 이미터의 emissionRate와 burst에 곱하는 배율. 기본값 1.0. */
+    void setLayerEmissionScale(RenderLayer layer, float scale) { layerEmissionScales_[static_cast<size_t>(layer)] = scale; }
+    size_t getLayerParticleCount(RenderLayer layer) const { return layerCounts_[static_cast<size_t>(layer)]; }
+
+    /* 파티클이 움직이거나 생기거나 사라진 update마다 증가함. 화면 변경 감지용. */
+    uint64_t getRevision() const { return revision_; }
+
+private:
+    static constexpr size_t LAYER_COUNT = static_cast<size_t>(RenderLayer::COUNT);
+
+    void emit(ParticleEmitterComponent& emitter, float x, float y, int count);
+    float randomFloat(); /* [0, 1) */
+
+    RenderManager& renderManager_;
+    uint32_t randomState_ = 0x9E3779B9u;
+    uint64_t revision_ = 0;
+    size_t lastEmitterCount_ = 0;
+
+    std::array<size_t, LAYER_COUNT> layerBudgets_;
+    std::array<float, LAYER_COUNT> layerEmissionScales_;
+    std::array<size_t, LAYER_COUNT> layerCounts_{};
+
+    std::vector<SDL_Vertex> vertices_;
+};
@@ -18,8 +18,8 @@
 
 /*
  * @class PlayerAnimationControlSystem
- * @brief PlayerAnimationControllerComponent를 가진 엔티티의 애니메이션 상태를 제어하는 시스템임.
- *        주로 이동 상태에 따라 걷기, 점프 애니메이션을 전환함.
+ * @brief PlayerAnimationControllerComponent를 가진 엔티티의 애니메이션 표시를 제어하는 시스템임.
+ *        가속 방향에 따라 좌우 반전만 처리함. 클립 전환은 AnimationStateMachineSystem이 담당함.
 */ 
 class GNEngine_API PlayerAnimationControlSystem {
 public:
@@ -40,29 +40,6 @@ private:
     AnimationManager& animationManager_;
     TextureManager& textureManager_;
     RenderManager& renderManager_;
-
-    /*
-     * @brief 현재 애니메이션을 설정하고 RenderComponent를 업데이트함.
-     * @param entityManager - 엔티티와 컴포넌트를 관리하는 EntityManager.
-     * @param entityId - 애니메이션을 제어할 엔티티의 ID.
-     * @param newAnimation - 새로 설정할 애니메이션 데이터.
-     */
-    void setCurrentAnimation(EntityManager& entityManager, EntityID entityId, std::shared_ptr<Animation> newAnimation);
-
-    /*
-     * @brief 현재 애니메이션이 점프 애니메이션인지 확인.
-     */
-    bool isJumpAnimationActive(AnimationComponent* animation, std::shared_ptr<Animation> jumpAnimationData) const;
-
-    /*
-     * @brief 걷기 애니메이션으로 전환함.
-     */
-    void playWalkAnimation(EntityManager& entityManager, EntityID entityId, std::shared_ptr<Animation> walkAnimationData);
-
-    /*
-     * @brief 점프 애니메이션으로 전환함.
-     */
-    void playJumpAnimation(EntityManager& entityManager, EntityID entityId, std::shared_ptr<Animation> jumpAnimationData);
 };
 
 
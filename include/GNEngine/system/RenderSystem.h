@@ -10,27 +10,226 @@
 #include "GNEngine/component/TextComponent.h"
 #include "GNEngine/core/Texture.h"
 #include "GNEngine/component/CameraComponent.h"
+#include "GNEngine/core/RenderLayer.h"
+
+#include <array>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <functional>
+#include <filesystem>
 
 
 /*
  * @class RenderSystem
  * @brief 엔티티의 RenderComponent와 TextComponent를 화면에 렌더링하는 시스템임.
+ *        정적(static)으로 지정한 레이어는 STATIC_TILE_SIZE 픽셀 크기의 타겟 텍스처 타일에 한 번 그려 두고,
+ *        레이어 내용이나 줌이 바뀔 때만 다시 그림. 그 외 프레임에는 보이는 타일만 블릿함.
+ *        CameraComponent마다 자기 뷰포트에 컬링된 패스를 renderOrder 순서로 그림.
+ *        드로우 아이템(위치, 크기, 소스 영역)과 카메라별 가시성은 프레임마다 한 번만 계산하여 모든 카메라가 공유함.
+ *        화면 공간 엔티티(UI, 페이드 등)는 모든 카메라 패스가 끝난 뒤 전체 화면 뷰포트에서 레이어 순서대로 한 번만 그림.
+ *        레이어마다 Y 또는 사용자 깊이로 정렬할 수 있으며, 이전 프레임의 순서에서 삽입 정렬하므로 움직임이 적으면 거의 선형 비용임.
+ *        화면에 보이는 내용(드로우 아이템, 카메라, 배경색, 레이어 렌더러 리비전)의 해시가 이전 프레임과 같으면
+ *        clear, 렌더 패스, present를 모두 건너뜀.
+ *        렌더 패스는 SDL을 바로 호출하지 않고 RenderCommandList에 기록한 뒤 RenderManager::execute로 한 번에 실행함.
  */
 
 class GNEngine_API RenderSystem {
 public:
     RenderSystem(RenderManager& renderManager);
+    ~RenderSystem();
 
     /*
      * @brief 모든 렌더링 가능한 엔티티를 업데이트하고 그림.
-     *        내부적으로 활성화된 카메라를 찾아 뷰포트를 설정함.
+     *        CameraComponent가 없으면 RenderManager의 카메라 상태로 윈도우 전체에 그림.
      * @param entityManager - 엔티티와 컴포넌트를 관리하는 EntityManager.
      * @param deltaTime - 이 시스템에서는 사용되지 않음.
      */
     void update(EntityManager& entityManager, float deltaTime);
 
+    /*
+     * @brief 레이어를 정적 레이어로 지정하거나 해제함. 해제하면 캐시된 타일을 모두 파괴함.
+     *        애니메이션이 있거나 화면 공간에 고정된 엔티티는 캐시하지 않고 매 프레임 그림.
+     *        캐시된 엔티티가 들어오거나 나가고, 위치/크기/텍스처/소스 영역/반전이 바뀌면 다음 프레임에 자동으로 타일을 다시 구움.
+     */
+    void setLayerStatic(RenderLayer layer, bool isStatic);
+    bool isLayerStatic(RenderLayer layer) const;
+
+    /* 레이어 안의 그리기 순서. NONE은 엔티티 순서 그대로임. */
+    enum class LayerSortMode { NONE, Y, DEPTH };
+
+    /*
+     * @brief 레이어 안의 엔티티를 뒤에서 앞으로 정렬해서 그리게 함. 키가 같으면 이전 프레임의 순서를 유지함.
+     * @param mode Y면 TransformComponent의 positionY(기준점의 Y. 발밑 기준으로 정렬하려면 pivotY를 1.0으로 둠),
+     *             DEPTH면 RenderComponent의 depth를 키로 씀. 작은 값부터 그림.
+     * @param resortInterval(1) 키를 다시 읽어 정렬하는 프레임 간격. 그 사이 프레임에는 이전 순서를 재사용하고 새 엔티티만 끼워 넣음.
+     */
+    void setLayerSort(RenderLayer layer, LayerSortMode mode, int resortInterval = 1);
+    LayerSortMode getLayerSortMode(RenderLayer layer) const;
+
+    /* 정적 레이어의 캐시를 강제로 무효화함. 텍스처 픽셀 내용이 바뀌는 등 시스템이 감지할 수 없는 변경 후에 호출함. */
+    void markLayerDirty(RenderLayer layer);
+
+    /*
+     * @brief 레이어마다 호출되는 추가 렌더러를 등록함. 해당 레이어의 스프라이트보다 먼저 호출됨.
+     *        타일맵, 파티클처럼 엔티티 단위가 아닌 배치 렌더링을 레이어 순서에 끼워 넣을 때 사용함.
+     *        프레임을 명령 목록에 기록하는 중에 호출되므로 SDL 렌더러에 직접 그리지 말고 RenderManager(drawQuads 등)로 그려야 함.
+     * @param revision(nullptr) 렌더러가 그리는 내용이 바뀌면 달라지는 값을 돌려주는 함수.
+     *        nullptr이면 내용이 매 프레임 바뀐다고 보므로 present 생략이 동작하지 않음.
+     */
+    using LayerRenderer = std::function<void(EntityManager&, RenderLayer)>;
+    using LayerRevision = std::function<uint64_t(EntityManager&)>;
+    void addLayerRenderer(LayerRenderer renderer, LayerRevision revision = nullptr) {
+        layerRenderers_.push_back({std::move(renderer), std::move(revision)});
+    }
+
+    /* 화면이 바뀌지 않은 프레임의 렌더링과 present 생략 여부. 기본값은 켜짐. */
+    void setPresentSkipping(bool isEnabled) { isPresentSkipping_ = isEnabled; hasLastFrame_ = false; }
+    bool isPresentSkipping() const { return isPresentSkipping_; }
+
+    /*
+     * @brief 컬링 결과로 AnimationComponent의 AnimationLod를 정할지 여부. 기본값은 켜짐.
+     *        어느 카메라에도 보이지 않는 애니메이션은 HIDDEN, 화면에서 높이가 minScreenHeight 픽셀보다 작으면 REDUCED가 됨.
+     *        HIDDEN이던 엔티티가 보이게 되면 그리기 전에 쌓인 시간만큼 바로 따라잡음.
+     * @param minScreenHeight(0) 0이면 REDUCED를 쓰지 않음.
+     */
+    void setAnimationCulling(bool isEnabled, float minScreenHeight = 0.0f) {
+        isAnimationCulling_ = isEnabled;
+        animationLodMinHeight_ = minScreenHeight;
+    }
+    bool isAnimationCulling() const { return isAnimationCulling_; }
+
+    /* 다음 프레임을 무조건 다시 그리게 함. 창 크기 변경, 텍스처 내용 변경 등 시스템이 감지할 수 없는 변화 후에 호출함. */
+    void invalidateFrame() { hasLastFrame_ = false; }
+
+    /* 다음으로 그리는 프레임의 명령 목록을 path에 저장함. 프로파일링용 replay에 사용함. */
+    void dumpNextFrame(const std::filesystem::path& path) { dumpPath_ = path; invalidateFrame(); }
+    /* 마지막으로 그린 프레임의 명령 목록. */
+    const RenderCommandList& getCommandList() const { return commandList_; }
+
 private:
+    static constexpr int STATIC_TILE_SIZE = 512; /* 타일 한 변의 픽셀 크기 */
+    static constexpr size_t MAX_CACHED_TILES_PER_LAYER = 64; /* 초과 시 이번 프레임에 어느 카메라도 쓰지 않은 타일을 해제함 */
+    static constexpr size_t MAX_CAMERAS = 32; /* 가시성 비트마스크 크기. 초과한 카메라는 그리지 않음 */
+    static constexpr int MAX_SKIPPED_FRAMES = 60; /* 창이 가려졌다 드러나는 경우 등을 대비해 이만큼 생략하면 한 번은 다시 그림 */
+
+    struct LayerRendererEntry {
+        LayerRenderer render;
+        LayerRevision revision;
+    };
+
+    /* 카메라 하나의 뷰. viewport는 렌더 출력 픽셀 기준이며, min/max는 보이는 월드 영역임. */
+    struct CameraView {
+        SDL_Rect viewport;
+        float x, y, zoom;
+        int renderOrder;
+        bool usesViewport; /* false면 CameraComponent 없이 RenderManager 상태를 그대로 씀 */
+        float minX, minY, maxX, maxY;
+    };
+
+    /* 프레임마다 엔티티당 한 번 만드는 드로우 정보. 카메라 패스들이 공유함. */
+    struct DrawItem {
+        enum class Kind : uint8_t { SPRITE, TEXT, FILL };
+        Kind kind;
+        bool isOverlay;      /* 화면 공간이거나 화면 전체를 채우는 아이템. 카메라 컬링을 하지 않음 */
+        bool isStaticCached; /* 정적 레이어 타일에 구워져 있는 아이템 */
+        bool isRotated;      /* 회전했거나 기준점이 중심이 아니어서 회전 쿼드로 그리는 아이템 */
+        uint32_t cameraMask; /* 이 아이템이 보이는 카메라 비트 */
+        SDL_Texture* texture;
+        SDL_Rect srcRect;
+        SDL_FlipMode flip;
+        float x, y;          /* 스프라이트는 중심(화면 공간이면 좌상단), 텍스트는 기준 위치 */
+        float w, h;          /* 스프라이트는 크기, 텍스트는 스케일 */
+        float halfExtentX, halfExtentY; /* 컬링용 월드 AABB 반폭 */
+        float angle;         /* 도 단위 회전각 */
+        float sinAngle, cosAngle;
+        float pivotX, pivotY;
+        const TextLayout* layout;
+        SDL_FColor color;
+        SDL_Color fillColor;
+        uint32_t animIndex;  /* 애니메이션 스프라이트의 AnimationComponent SoA 인덱스. 없으면 UINT32_MAX */
+    };
+
+    /* 정적 레이어 캐시에 구워지는 스프라이트 하나. 월드 좌표 기준 AABB를 함께 가짐. */
+    struct StaticSprite {
+        SDL_Texture* texture;
+        SDL_Rect srcRect;
+        float x, y; /* 중심 좌표 */
+        float w, h;
+        SDL_FlipMode flip;
+    };
+
+    struct StaticTile {
+        SDL_Texture* texture;  /* nullptr은 비어 있는 타일을 뜻함 */
+        uint64_t lastUsedFrame; /* 마지막으로 어느 카메라든 이 타일을 블릿한 renderFrame_ */
+    };
+
+    struct StaticLayerCache {
+        bool isStatic = false;
+        bool isDirty = true;
+        uint64_t signature = 0; /* 캐시된 엔티티 상태의 해시. buildDrawItems가 계산함 */
+        float zoom = 0.0f;
+        float tileWorldSize = 0.0f;
+        float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+        std::vector<StaticSprite> sprites;
+        std::unordered_map<int64_t, StaticTile> tiles;
+    };
+
+    /* 레이어 정렬 상태. entries는 이전 프레임의 정렬 결과이며 다음 프레임 삽입 정렬의 시작점이 됨. */
+    struct SortEntry {
+        float key;
+        EntityID entity;
+    };
+
+    struct LayerSortState {
+        LayerSortMode mode = LayerSortMode::NONE;
+        int resortInterval = 1;
+        int framesSinceSort = 0;
+        std::vector<SortEntry> entries;
+    };
+
+    void sortLayer(EntityManager& entityManager, LayerSortState& state, std::vector<EntityID>& bucket);
+    void collectCameras(EntityManager& entityManager);
+    void buildDrawItems(EntityManager& entityManager, const std::vector<EntityID>& entities, std::vector<DrawItem>& outItems, uint64_t& outStaticSignature);
+    bool computeFrameSignature(EntityManager& entityManager, uint64_t& outSignature);
+    void computeRotations();
+    void computeVisibility();
+    void updateAnimationLod(EntityManager& entityManager);
+    void renderPass(EntityManager& entityManager, size_t cameraIndex);
+    void drawItem(const DrawItem& item);
+
+    bool prepareStaticLayer(EntityManager& entityManager, StaticLayerCache& cache, const std::vector<EntityID>& entities, uint64_t signature, float zoom);
+    bool drawStaticTiles(StaticLayerCache& cache);
+    bool buildStaticTile(const StaticLayerCache& cache, int tileX, int tileY, SDL_Texture*& outTile);
+    void releaseTiles(StaticLayerCache& cache);
+    void trimStaticTiles();
+
     RenderManager& renderManager_;
+
+    std::array<std::vector<EntityID>, static_cast<size_t>(RenderLayer::COUNT)> layerBuckets_;
+    std::array<std::vector<DrawItem>, static_cast<size_t>(RenderLayer::COUNT)> layerItems_;
+    std::array<StaticLayerCache, static_cast<size_t>(RenderLayer::COUNT)> staticLayers_;
+    std::array<bool, static_cast<size_t>(RenderLayer::COUNT)> isStaticLayerReady_{}; /* 이번 프레임에 캐시를 쓸 수 있는지 */
+    std::vector<SDL_Texture*> retiredTiles_; /* 기록된 명령이 아직 쓸 수 있어 execute 뒤에 파괴할 타일 */
+    uint64_t renderFrame_ = 0;               /* 명령을 기록한 프레임 수. 타일 사용 시점 비교용 */
+    std::array<LayerSortState, static_cast<size_t>(RenderLayer::COUNT)> layerSorts_;
+    std::vector<uint32_t> entityStamps_; /* 정렬 시 버킷 소속 확인용. EntityID로 인덱싱함 */
+    uint32_t sortStamp_ = 0;
+    std::vector<CameraView> cameras_;
+    std::vector<DrawItem*> rotatedItems_; /* sin/cos를 한꺼번에 구하기 위한 임시 버퍼 */
+    std::vector<float> rotationAngles_;
+    std::vector<float> rotationSins_;
+    std::vector<float> rotationCoss_;
+    std::vector<LayerRendererEntry> layerRenderers_;
+    RenderCommandList commandList_;
+    std::filesystem::path dumpPath_;
+
+    bool isAnimationCulling_ = true;
+    float animationLodMinHeight_ = 0.0f;
+    bool isPresentSkipping_ = true;
+    bool hasLastFrame_ = false;
+    uint64_t lastFrameSignature_ = 0;
+    int skippedFrames_ = 0;
 };
 
 
@@ -5,12 +5,16 @@
 #include "GNEngine/component/SoundComponent.h"
 #include "GNEngine/component/TransformComponent.h"
 #include "GNEngine/manager/SoundManager.h"
+#include "GNEngine/system/AnimationSystem.h"
 
+#include <memory>
 #include <vector>
 
 /*
  * @class SoundSystem
  * @brief SoundComponent와 TransformComponent를 가진 엔티티의 사운드 위치를 업데이트하고 사운드를 재생하는 시스템임.
+ *        setAnimationEventSource로 AnimationSystem을 연결하면 프레임 이벤트 버퍼를 update마다 한 번 훑어
+ *        mapAnimationEvent로 지정한 사운드를 이벤트가 난 엔티티 위치에서 재생함.
 */
 class GNEngine_API SoundSystem {
 public:
@@ -23,8 +27,29 @@ public:
      */
     void update(EntityManager& entityManager, float deltaTime);
 
+    /* 프레임 이벤트를 읽을 AnimationSystem. nullptr이면 이벤트 사운드를 재생하지 않음. */
+    void setAnimationEventSource(const AnimationSystem* animationSystem) { animationSystem_ = animationSystem; }
+
+    /* event가 발생하면 sound를 재생하게 함. sound가 nullptr이면 매핑을 지움. */
+    void mapAnimationEvent(AnimationEventId event, std::shared_ptr<Sound> sound, SoundPriority priority = SoundPriority::NORMAL,
+                           float volume = 1.0f, bool spatialized = false);
+
 private:
+    struct AnimationEventSound {
+        std::shared_ptr<Sound> sound;
+        SoundPriority priority = SoundPriority::NORMAL;
+        float volume = 1.0f;
+        bool spatialized = false;
+    };
+
+    void playAnimationEvents(EntityManager& entityManager);
+    void processRequests(EntityManager& entityManager, ComponentArray<SoundComponent>& soundComponentArray);
+    void syncVoices(EntityManager& entityManager, ComponentArray<SoundComponent>* soundComponentArray);
+
     SoundManager& soundManager_;
+    const AnimationSystem* animationSystem_ = nullptr;
+    uint64_t lastEventFrame_ = 0;
+    std::vector<AnimationEventSound> animationEventSounds_; /* AnimationEventId로 인덱싱함 */
 };
 
 
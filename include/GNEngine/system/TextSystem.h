@@ -8,9 +8,11 @@
 
 #include <SDL3/SDL.h>
 
-/* 
- *              
-*/
+/*
+ * @class TextSystem
+ * @brief TextComponent의 문자열을 글리프 아틀라스 쿼드로 레이아웃하는 시스템임.
+ *        텍스트가 바뀌어도 정점 데이터만 다시 쓰며, 글리프는 TextManager의 아틀라스에 한 번만 래스터라이즈됨.
+ */
 class GNEngine_API TextSystem {
 public:
     TextSystem(EntityManager& entityManager, TextManager& textManager, SDL_Renderer* renderer);
@@ -0,0 +1,44 @@
+#pragma once
+#include "../GNEngine_API.h"
+
+#include <vector>
+#include <cstdint>
+
+#include "GNEngine/manager/EntityManager.h"
+#include "GNEngine/manager/RenderManager.h"
+#include "GNEngine/component/TilemapComponent.h"
+#include "GNEngine/core/RenderLayer.h"
+
+/*
+ * @class TilemapRenderSystem
+ * @brief TilemapComponent를 청크 단위로 그리는 시스템임.
+ *        카메라에 보이는 청크만 골라 스프라이트 배치로 그림. 배치를 거치므로 래스터라이저에도 그려짐.
+ *        청크 정점은 월드 좌표로 캐시해 두고, 타일이 바뀌었을 때만 다시 만듦.
+ *        실제 그리기는 RenderSystem의 레이어 렌더러로 등록된 renderLayer에서 레이어 순서에 맞춰 수행함.
+ */
+class GNEngine_API TilemapRenderSystem {
+public:
+    TilemapRenderSystem(RenderManager& renderManager);
+
+    /*
+     * @brief 오랫동안 그려지지 않은 청크의 정점 캐시를 해제함.
+     * @param entityManager - 엔티티와 컴포넌트를 관리하는 EntityManager.
+     * @param deltaTime - 이 시스템에서는 사용되지 않음.
+     */
+    void update(EntityManager& entityManager, float deltaTime);
+
+    /* layer에 속한 모든 타일맵의 보이는 청크를 그림. */
+    void renderLayer(EntityManager& entityManager, RenderLayer layer);
+
+    /* 모든 타일맵의 내용을 대표하는 값. 타일이 바뀌거나 타일맵이 추가/제거되면 달라짐. */
+    uint64_t getRevision(EntityManager& entityManager);
+
+private:
+    static constexpr uint64_t GEOMETRY_KEEP_FRAMES = 120; /* 이 프레임 수 동안 안 보이면 정점 캐시 해제 */
+
+    void buildChunkGeometry(const TilemapComponent& tilemap, TilemapComponent::Chunk& chunk, int chunkX, int chunkY);
+
+    RenderManager& renderManager_;
+    uint64_t frame_ = 0;
+    std::vector<SDL_Vertex> screenVertices_;
+};
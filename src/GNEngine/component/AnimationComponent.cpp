@@ -7,7 +7,10 @@
  * @param playOnAwake - 컴포넌트 생성 시 바로 애니메이션을 재생할지 여부 (기본값: true).
  */
 AnimationComponent::AnimationComponent(std::shared_ptr<Animation> animation, bool playOnAwake)
-    : animation_(std::move(animation)),
+    : AnimationComponent(animation ? animation->getHandle() : INVALID_ANIMATION_HANDLE, playOnAwake) {}
+
+AnimationComponent::AnimationComponent(AnimationHandle handle, bool playOnAwake)
+    : handle_(handle),
       currentFrame_(0),
       frameTimer_(0.0f),
       isPlaying_(playOnAwake),
@@ -49,8 +52,9 @@ void AnimationComponent::stop() {
  * @return 현재 프레임의 SDL_Rect.
  */
 const SDL_Rect& AnimationComponent::getCurrentFrameRect() const {
-    if (animation_) {
-        return animation_->getFrame(currentFrame_);
+    const AnimationTable& table = AnimationTable::instance();
+    if (table.isValid(handle_)) {
+        return table.getFrameRect(table.getClip(handle_).firstFrame + currentFrame_);
     }
     static const SDL_Rect emptyRect = {0, 0, 0, 0};
     return emptyRect;
@@ -0,0 +1,86 @@
+#include "GNEngine/component/TilemapComponent.h"
+
+#include <algorithm>
+#include <cmath>
+
+TilemapComponent::TilemapComponent(SDL_Texture* atlas, int widthInTiles, int heightInTiles, int tileWidth, int tileHeight,
+                                   RenderLayer layer, float originX, float originY)
+    : atlas_(atlas), widthInTiles_(std::max(widthInTiles, 0)), heightInTiles_(std::max(heightInTiles, 0)),
+      tileWidth_(std::max(tileWidth, 1)), tileHeight_(std::max(tileHeight, 1)), layer_(layer), originX_(originX), originY_(originY),
+      solidTiles_(UINT16_MAX + 1, false)
+{
+    if (atlas_) {
+        SDL_GetTextureSize(atlas_, &atlasWidth_, &atlasHeight_);
+        atlasColumns_ = std::max(static_cast<int>(atlasWidth_) / tileWidth_, 1);
+    } else {
+        SDL_Log("TilemapComponent::TilemapComponent - Atlas texture is null.");
+    }
+
+    chunksX_ = (widthInTiles_ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunksY_ = (heightInTiles_ + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunks_.resize(static_cast<size_t>(chunksX_) * chunksY_);
+}
+
+void TilemapComponent::setTile(int tileX, int tileY, uint16_t tile) {
+    if (tileX < 0 || tileY < 0 || tileX >= widthInTiles_ || tileY >= heightInTiles_) {
+        return;
+    }
+
+    Chunk& chunk = getChunk(tileX / CHUNK_SIZE, tileY / CHUNK_SIZE);
+    uint16_t& slot = chunk.tiles[(tileY % CHUNK_SIZE) * CHUNK_SIZE + (tileX % CHUNK_SIZE)];
+    if (slot == tile) {
+        return;
+    }
+
+    if (slot == EMPTY_TILE) ++chunk.tileCount;
+    if (tile == EMPTY_TILE) --chunk.tileCount;
+    slot = tile;
+    chunk.isGeometryDirty = true;
+    ++revision_;
+}
+
+uint16_t TilemapComponent::getTile(int tileX, int tileY) const {
+    if (tileX < 0 || tileY < 0 || tileX >= widthInTiles_ || tileY >= heightInTiles_) {
+        return EMPTY_TILE;
+    }
+    const Chunk& chunk = chunks_[(tileY / CHUNK_SIZE) * chunksX_ + (tileX / CHUNK_SIZE)];
+    return chunk.tiles[(tileY % CHUNK_SIZE) * CHUNK_SIZE + (tileX % CHUNK_SIZE)];
+}
+
+void TilemapComponent::setSolidTile(uint16_t tile, bool isSolid) {
+    solidTiles_[tile] = isSolid;
+}
+
+bool TilemapComponent::worldToTile(float worldX, float worldY, int& outTileX, int& outTileY) const {
+    outTileX = static_cast<int>(std::floor((worldX - originX_) / tileWidth_));
+    outTileY = static_cast<int>(std::floor((worldY - originY_) / tileHeight_));
+    return outTileX >= 0 && outTileY >= 0 && outTileX < widthInTiles_ && outTileY < heightInTiles_;
+}
+
+bool TilemapComponent::isSolidAt(float worldX, float worldY) const {
+    int tileX, tileY;
+    if (!worldToTile(worldX, worldY, tileX, tileY)) {
+        return false;
+    }
+    return solidTiles_[getTile(tileX, tileY)];
+}
+
+bool TilemapComponent::overlapsSolid(float minX, float minY, float maxX, float maxY) const {
+    int tileX0, tileY0, tileX1, tileY1;
+    worldToTile(minX, minY, tileX0, tileY0);
+    worldToTile(maxX, maxY, tileX1, tileY1);
+
+    tileX0 = std::max(tileX0, 0);
+    tileY0 = std::max(tileY0, 0);
+    tileX1 = std::min(tileX1, widthInTiles_ - 1);
+    tileY1 = std::min(tileY1, heightInTiles_ - 1);
+
+    for (int tileY = tileY0; tileY <= tileY1; ++tileY) {
+        for (int tileX = tileX0; tileX <= tileX1; ++tileX) {
+            if (solidTiles_[getTile(tileX, tileY)]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -12,10 +12,13 @@ Animation::Animation(std::filesystem::path texturePath, bool loop)
  * @brief 애니메이션에 새 프레임을 추가함.
  * @param frameRect - 스프라이트 시트에서 해당 프레임이 차지하는 사각형 영역.
  * @param duration - 해당 프레임의 지속 시간 (밀리초 단위).
+ * @param event - 이 프레임에 들어갈 때 발생시킬 이벤트 이름. 비어 있으면 이벤트 없음.
  */
-void Animation::addFrame(SDL_Rect frameRect, int duration) {
+void Animation::addFrame(SDL_Rect frameRect, int duration, const std::string& event) {
     frames_.push_back(frameRect);
     frameDurations_.push_back(duration);
+    frameEvents_.push_back(event);
+    handle_ = INVALID_ANIMATION_HANDLE;
 }
 
 /*
@@ -43,6 +46,19 @@ int Animation::getFrameDuration(int frameIndex) const {
     return 0;
 }
 
+/*
+ * @brief 특정 인덱스의 프레임에 달린 이벤트 이름을 반환함.
+ * @param frameIndex - 가져올 프레임의 인덱스.
+ * @return 이벤트 이름. 이벤트가 없거나 인덱스가 유효하지 않으면 빈 문자열을 반환.
+ */
+const std::string& Animation::getFrameEvent(int frameIndex) const {
+    if (frameIndex >= 0 && frameIndex < frameEvents_.size()) {
+        return frameEvents_[frameIndex];
+    }
+    static const std::string noEvent;
+    return noEvent;
+}
+
 /*
  * @brief 전체 프레임 수를 반환함.
  * @return 애니메이션의 총 프레임 수.
@@ -67,5 +83,12 @@ bool Animation::isLooping() const {
     return loop_;
 }
 
+AnimationHandle Animation::getHandle() const {
+    if (handle_ == INVALID_ANIMATION_HANDLE) {
+        handle_ = AnimationTable::instance().registerAnimation(*this);
+    }
+    return handle_;
+}
+
 
 
@@ -0,0 +1,107 @@
+#include "GNEngine/core/AnimationStateMachine.h"
+
+int AnimationStateMachine::addParameter(const std::string& name, ParameterSource source, float defaultValue) {
+    if (parameters_.size() >= MAX_PARAMETERS) {
+        return -1;
+    }
+    parameters_.push_back({name, source, defaultValue});
+    hasBoundParameters_ = hasBoundParameters_ || source != ParameterSource::NONE;
+    return static_cast<int>(parameters_.size() - 1);
+}
+
+int AnimationStateMachine::addEvent(const std::string& name) {
+    if (events_.size() >= MAX_EVENTS) {
+        return -1;
+    }
+    events_.push_back(name);
+    return static_cast<int>(events_.size() - 1);
+}
+
+uint16_t AnimationStateMachine::addState(const std::string& name, AnimationHandle clip, SDL_Texture* texture) {
+    State state;
+    state.name = name;
+    state.clip = clip;
+    state.texture = texture;
+
+    const AnimationTable& table = AnimationTable::instance();
+    if (table.isValid(clip)) {
+        state.firstFrame = table.getFrameRect(table.getClip(clip).firstFrame);
+    }
+
+    states_.push_back(std::move(state));
+    stateTransitions_.emplace_back();
+    return static_cast<uint16_t>(states_.size() - 1);
+}
+
+void AnimationStateMachine::addTransition(uint16_t from, const Transition& transition) {
+    if (from == ANY_STATE) {
+        anyStateTransitions_.push_back(transition);
+    } else {
+        stateTransitions_[from].push_back(transition);
+    }
+    usesFinished_ = usesFinished_ || transition.type == ConditionType::FINISHED;
+}
+
+int AnimationStateMachine::findParameter(const std::string& name) const {
+    for (size_t i = 0; i < parameters_.size(); ++i) {
+        if (parameters_[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int AnimationStateMachine::findEvent(const std::string& name) const {
+    for (size_t i = 0; i < events_.size(); ++i) {
+        if (events_[i] == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+int AnimationStateMachine::findState(const std::string& name) const {
+    for (size_t i = 0; i < states_.size(); ++i) {
+        if (states_[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool AnimationStateMachine::matches(const Transition& transition, const float* parameters, uint32_t events, float stateTime, bool isFinished) const {
+    if (stateTime < transition.minStateTime) {
+        return false;
+    }
+
+    switch (transition.type) {
+        case ConditionType::EVENT:
+            return (events >> transition.index) & 1u;
+        case ConditionType::FINISHED:
+            return isFinished;
+        case ConditionType::PARAMETER: {
+            const float value = parameters[transition.index];
+            switch (transition.comparison) {
+                case Comparison::GREATER: return value > transition.threshold;
+                case Comparison::GREATER_EQUAL: return value >= transition.threshold;
+                case Comparison::LESS: return value < transition.threshold;
+                case Comparison::LESS_EQUAL: return value <= transition.threshold;
+            }
+        }
+    }
+    return false;
+}
+
+uint16_t AnimationStateMachine::evaluate(uint16_t state, const float* parameters, uint32_t events, float stateTime, bool isFinished) const {
+    for (const Transition& transition : anyStateTransitions_) {
+        if (transition.target != state && matches(transition, parameters, events, stateTime, isFinished)) {
+            return transition.target;
+        }
+    }
+    for (const Transition& transition : stateTransitions_[state]) {
+        if (matches(transition, parameters, events, stateTime, isFinished)) {
+            return transition.target;
+        }
+    }
+    return state;
+}
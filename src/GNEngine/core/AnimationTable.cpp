@@ -0,0 +1,55 @@
+#include "GNEngine/core/AnimationTable.h"
+#include "GNEngine/core/Animation.h"
+
+AnimationTable& AnimationTable::instance() {
+    static AnimationTable table;
+    return table;
+}
+
+AnimationHandle AnimationTable::registerAnimation(const Animation& animation) {
+    const int frameCount = animation.getFrameCount();
+    if (frameCount <= 0) {
+        return INVALID_ANIMATION_HANDLE;
+    }
+
+    Clip clip{};
+    clip.firstFrame = static_cast<uint32_t>(frameRects_.size());
+    clip.frameCount = static_cast<uint32_t>(frameCount);
+    clip.isLooping = animation.isLooping();
+
+    frameRects_.reserve(frameRects_.size() + frameCount);
+    frameDurations_.reserve(frameDurations_.size() + frameCount);
+    frameEvents_.reserve(frameEvents_.size() + frameCount);
+    for (int i = 0; i < frameCount; ++i) {
+        const float duration = static_cast<float>(animation.getFrameDuration(i)) / 1000.0f;
+        const AnimationEventId event = registerEvent(animation.getFrameEvent(i));
+        frameRects_.push_back(animation.getFrame(i));
+        frameDurations_.push_back(duration);
+        frameEvents_.push_back(event);
+        clip.totalDuration += duration;
+        clip.hasEvents = clip.hasEvents || event != NO_ANIMATION_EVENT;
+    }
+
+    clips_.push_back(clip);
+    texturePaths_.push_back(animation.getTexturePath());
+    return static_cast<AnimationHandle>(clips_.size() - 1);
+}
+
+AnimationEventId AnimationTable::registerEvent(const std::string& name) {
+    if (name.empty()) {
+        return NO_ANIMATION_EVENT;
+    }
+    auto it = eventIds_.find(name);
+    if (it != eventIds_.end()) {
+        return it->second;
+    }
+    const AnimationEventId event = static_cast<AnimationEventId>(eventNames_.size());
+    eventNames_.push_back(name);
+    eventIds_.emplace(name, event);
+    return event;
+}
+
+AnimationEventId AnimationTable::findEvent(const std::string& name) const {
+    auto it = eventIds_.find(name);
+    return it != eventIds_.end() ? it->second : NO_ANIMATION_EVENT;
+}
@@ -0,0 +1,96 @@
+#include "GNEngine/core/FastMath.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GNENGINE_FASTMATH_SSE2 1
+#endif
+
+namespace {
+    constexpr float DEG_TO_RAD = 0.017453292519943295f;
+    constexpr float TWO_OVER_PI = 0.6366197723675814f;
+    /* pi/2를 두 부분으로 나눠 범위 축소 오차를 줄임 (Cody-Waite) */
+    constexpr float PIO2_HI = 1.5707963705062866f;
+    constexpr float PIO2_LO = -4.37113900018624283e-8f;
+
+    /* [-pi/4, pi/4]에서의 최소최대 근사 계수 */
+    constexpr float SIN_C1 = -1.6666654611e-1f;
+    constexpr float SIN_C2 = 8.3321608736e-3f;
+    constexpr float SIN_C3 = -1.9515295891e-4f;
+    constexpr float COS_C1 = 4.166664568298827e-2f;
+    constexpr float COS_C2 = -1.388731625493765e-3f;
+    constexpr float COS_C3 = 2.443315711809948e-5f;
+}
+
+/*
+ * 사분면 j = round(x / (pi/2))를 구하고 나머지 r에 대해 sin/cos 다항식을 계산함.
+ * j가 홀수면 sin과 cos를 바꾸고, j & 2이면 sin, (j + 1) & 2이면 cos의 부호를 뒤집음.
+ */
+void FastMath::sinCosDegrees(float degrees, float& outSin, float& outCos) {
+    const float x = degrees * DEG_TO_RAD;
+    const int j = static_cast<int>(std::nearbyint(x * TWO_OVER_PI));
+    const float jf = static_cast<float>(j);
+    const float r = (x - jf * PIO2_HI) - jf * PIO2_LO;
+    const float r2 = r * r;
+
+    const float s = r + r * r2 * (SIN_C1 + r2 * (SIN_C2 + r2 * SIN_C3));
+    const float c = 1.0f - 0.5f * r2 + r2 * r2 * (COS_C1 + r2 * (COS_C2 + r2 * COS_C3));
+
+    const bool isSwapped = (j & 1) != 0;
+    float sinValue = isSwapped ? c : s;
+    float cosValue = isSwapped ? s : c;
+    if (j & 2) sinValue = -sinValue;
+    if ((j + 1) & 2) cosValue = -cosValue;
+
+    outSin = sinValue;
+    outCos = cosValue;
+}
+
+void FastMath::sinCosDegrees(const float* degrees, float* outSin, float* outCos, size_t count) {
+    size_t i = 0;
+
+#ifdef GNENGINE_FASTMATH_SSE2
+    const __m128 degToRad = _mm_set1_ps(DEG_TO_RAD);
+    const __m128 twoOverPi = _mm_set1_ps(TWO_OVER_PI);
+    const __m128 pio2Hi = _mm_set1_ps(PIO2_HI);
+    const __m128 pio2Lo = _mm_set1_ps(PIO2_LO);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i intOne = _mm_set1_epi32(1);
+    const __m128i intTwo = _mm_set1_epi32(2);
+
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_mul_ps(_mm_loadu_ps(degrees + i), degToRad);
+        const __m128i j = _mm_cvtps_epi32(_mm_mul_ps(x, twoOverPi)); // 기본 반올림 모드(가장 가까운 짝수)
+        const __m128 jf = _mm_cvtepi32_ps(j);
+        const __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(jf, pio2Hi)), _mm_mul_ps(jf, pio2Lo));
+        const __m128 r2 = _mm_mul_ps(r, r);
+
+        __m128 sinPoly = _mm_add_ps(_mm_set1_ps(SIN_C2), _mm_mul_ps(r2, _mm_set1_ps(SIN_C3)));
+        sinPoly = _mm_add_ps(_mm_set1_ps(SIN_C1), _mm_mul_ps(r2, sinPoly));
+        const __m128 s = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sinPoly));
+
+        __m128 cosPoly = _mm_add_ps(_mm_set1_ps(COS_C2), _mm_mul_ps(r2, _mm_set1_ps(COS_C3)));
+        cosPoly = _mm_add_ps(_mm_set1_ps(COS_C1), _mm_mul_ps(r2, cosPoly));
+        const __m128 c = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), cosPoly));
+
+        const __m128 swapMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, intOne), intOne));
+        __m128 sinValue = _mm_or_ps(_mm_and_ps(swapMask, c), _mm_andnot_ps(swapMask, s));
+        __m128 cosValue = _mm_or_ps(_mm_and_ps(swapMask, s), _mm_andnot_ps(swapMask, c));
+
+        // 부호 비트(bit 31)를 (j & 2) << 30 으로 만들어 xor
+        const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, intTwo), 30));
+        const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, intOne), intTwo), 30));
+        sinValue = _mm_xor_ps(sinValue, sinSign);
+        cosValue = _mm_xor_ps(cosValue, cosSign);
+
+        _mm_storeu_ps(outSin + i, sinValue);
+        _mm_storeu_ps(outCos + i, cosValue);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        sinCosDegrees(degrees[i], outSin[i], outCos[i]);
+    }
+}
@@ -0,0 +1,31 @@
+#include "GNEngine/core/FontFace.h"
+
+FontFace::FontFace(std::shared_ptr<const FontFileData> fileData, int pointSize, int style)
+    : fileData_(std::move(fileData)), pointSize_(pointSize), style_(style) {
+    if (!fileData_ || fileData_->bytes.empty()) {
+        SDL_Log("FontFace::FontFace - Font file data is empty.");
+        return;
+    }
+
+    // SDL_IOStream은 폰트가 닫힐 때 함께 닫힘(closeio = true). 메모리 자체는 fileData_가 소유함.
+    SDL_IOStream* stream = SDL_IOFromConstMem(fileData_->bytes.data(), fileData_->bytes.size());
+    if (!stream) {
+        SDL_Log("FontFace::FontFace - Failed to create IO stream for %s: %s", fileData_->path.string().c_str(), SDL_GetError());
+        return;
+    }
+
+    font_ = TTF_OpenFontIO(stream, true, static_cast<float>(pointSize_));
+    if (!font_) {
+        SDL_Log("FontFace::FontFace - Failed to open font %s (%dpt): %s", fileData_->path.string().c_str(), pointSize_, SDL_GetError());
+        return;
+    }
+    if (style_ != TTF_STYLE_NORMAL) {
+        TTF_SetFontStyle(font_, style_);
+    }
+}
+
+FontFace::~FontFace() {
+    if (font_) {
+        TTF_CloseFont(font_);
+    }
+}
@@ -0,0 +1,193 @@
+#include "GNEngine/core/GlyphAtlas.h"
+
+#include <algorithm>
+
+namespace {
+    constexpr int GLYPH_PADDING = 1; /* 선형 필터링 시 이웃 글리프가 번지지 않도록 두는 간격 */
+
+    SDL_Texture* createAtlasTexture(SDL_Renderer* renderer, SDL_Surface* pixels) {
+        SDL_Texture* texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, pixels->w, pixels->h);
+        if (!texture) {
+            SDL_Log("GlyphAtlas - Failed to create atlas texture: %s", SDL_GetError());
+            return nullptr;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        SDL_UpdateTexture(texture, nullptr, pixels->pixels, pixels->pitch);
+        return texture;
+    }
+}
+
+GlyphAtlas::GlyphAtlas(SDL_Renderer* renderer, TTF_Font* font)
+    : renderer_(renderer), font_(font) {
+    if (font_) {
+        lineSkip_ = TTF_GetFontLineSkip(font_);
+        fontHeight_ = TTF_GetFontHeight(font_);
+    }
+
+    pixels_ = SDL_CreateSurface(ATLAS_WIDTH, INITIAL_ATLAS_HEIGHT, SDL_PIXELFORMAT_ARGB8888);
+    if (!pixels_) {
+        SDL_Log("GlyphAtlas::GlyphAtlas - Failed to create atlas surface: %s", SDL_GetError());
+        return;
+    }
+    SDL_FillSurfaceRect(pixels_, nullptr, 0);
+    texture_ = createAtlasTexture(renderer_, pixels_);
+}
+
+GlyphAtlas::~GlyphAtlas() {
+    if (texture_) SDL_DestroyTexture(texture_);
+    if (pixels_) SDL_DestroySurface(pixels_);
+}
+
+/*
+ * @brief 아틀라스 높이를 두 배로 늘림. 기존 픽셀을 그대로 복사하므로 글리프 좌표는 유지됨.
+ */
+bool GlyphAtlas::grow() {
+    if (!pixels_ || pixels_->h >= MAX_ATLAS_HEIGHT) {
+        return false;
+    }
+
+    SDL_Surface* larger = SDL_CreateSurface(pixels_->w, std::min(pixels_->h * 2, MAX_ATLAS_HEIGHT), SDL_PIXELFORMAT_ARGB8888);
+    if (!larger) {
+        SDL_Log("GlyphAtlas::grow - Failed to create atlas surface: %s", SDL_GetError());
+        return false;
+    }
+    SDL_FillSurfaceRect(larger, nullptr, 0);
+    SDL_SetSurfaceBlendMode(pixels_, SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(pixels_, nullptr, larger, nullptr);
+
+    SDL_Texture* texture = createAtlasTexture(renderer_, larger);
+    if (!texture) {
+        SDL_DestroySurface(larger);
+        return false;
+    }
+
+    SDL_DestroySurface(pixels_);
+    if (texture_) SDL_DestroyTexture(texture_);
+    pixels_ = larger;
+    texture_ = texture;
+    return true;
+}
+
+bool GlyphAtlas::allocate(int w, int h, SDL_Rect& outRect) {
+    if (!pixels_ || w + GLYPH_PADDING > pixels_->w) {
+        return false;
+    }
+
+    // 현재 선반에 자리가 없으면 다음 선반으로
+    if (shelfX_ + w + GLYPH_PADDING > pixels_->w) {
+        shelfY_ += shelfHeight_;
+        shelfX_ = 0;
+        shelfHeight_ = 0;
+    }
+    while (shelfY_ + h + GLYPH_PADDING > pixels_->h) {
+        if (!grow()) {
+            return false;
+        }
+    }
+
+    outRect = {shelfX_, shelfY_, w, h};
+    shelfX_ += w + GLYPH_PADDING;
+    shelfHeight_ = std::max(shelfHeight_, h + GLYPH_PADDING);
+    return true;
+}
+
+const GlyphAtlas::Glyph* GlyphAtlas::getGlyph(uint32_t codepoint) {
+    auto it = glyphs_.find(codepoint);
+    if (it != glyphs_.end()) {
+        return &it->second;
+    }
+    if (!font_ || !texture_) {
+        return nullptr;
+    }
+
+    int minX, maxX, minY, maxY, advance;
+    if (!TTF_GetGlyphMetrics(font_, codepoint, &minX, &maxX, &minY, &maxY, &advance)) {
+        return nullptr;
+    }
+
+    Glyph glyph = {{0, 0, 0, 0}, advance};
+
+    // 흰색으로 한 번만 래스터라이즈. 공백처럼 그릴 것이 없는 글리프는 렌더링이 실패할 수 있으며 advance만 씀.
+    SDL_Surface* surface = TTF_RenderGlyph_Blended(font_, codepoint, {255, 255, 255, 255});
+    if (surface && surface->w > 0 && surface->h > 0) {
+        if (!allocate(surface->w, surface->h, glyph.rect)) {
+            SDL_Log("GlyphAtlas::getGlyph - Atlas is full, glyph U+%04X dropped.", codepoint);
+            SDL_DestroySurface(surface);
+            return nullptr;
+        }
+
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(surface, nullptr, pixels_, &glyph.rect);
+
+        const Uint8* src = static_cast<const Uint8*>(pixels_->pixels) + glyph.rect.y * pixels_->pitch + glyph.rect.x * 4;
+        SDL_UpdateTexture(texture_, &glyph.rect, src, pixels_->pitch);
+    }
+    if (surface) {
+        SDL_DestroySurface(surface);
+    }
+
+    return &glyphs_.emplace(codepoint, glyph).first->second;
+}
+
+int GlyphAtlas::getKerning(uint32_t previous, uint32_t codepoint) {
+    const uint64_t key = (static_cast<uint64_t>(previous) << 32) | codepoint;
+    auto it = kerning_.find(key);
+    if (it != kerning_.end()) {
+        return it->second;
+    }
+
+    int kerning = 0;
+    if (font_ && !TTF_GetGlyphKerning(font_, previous, codepoint, &kerning)) {
+        kerning = 0;
+    }
+    kerning_.emplace(key, kerning);
+    return kerning;
+}
+
+void GlyphAtlas::layoutText(const std::string& text, TextLayout& out) {
+    out.atlas = this;
+    out.quads.clear();
+    out.width = 0.0f;
+
+    float penX = 0.0f;
+    float penY = 0.0f;
+    uint32_t previous = 0;
+
+    const char* cursor = text.c_str();
+    size_t remaining = text.size();
+    while (remaining > 0) {
+        const uint32_t codepoint = SDL_StepUTF8(&cursor, &remaining);
+        if (codepoint == 0) {
+            break;
+        }
+        if (codepoint == '\n') {
+            out.width = std::max(out.width, penX);
+            penX = 0.0f;
+            penY += static_cast<float>(lineSkip_);
+            previous = 0;
+            continue;
+        }
+
+        if (previous != 0) {
+            penX += static_cast<float>(getKerning(previous, codepoint));
+        }
+
+        const Glyph* glyph = getGlyph(codepoint);
+        if (!glyph) {
+            previous = 0;
+            continue;
+        }
+        if (glyph->rect.w > 0) {
+            const SDL_Rect& r = glyph->rect;
+            out.quads.push_back({
+                {static_cast<float>(r.x), static_cast<float>(r.y), static_cast<float>(r.w), static_cast<float>(r.h)},
+                penX, penY, static_cast<float>(r.w), static_cast<float>(r.h)
+            });
+        }
+        penX += static_cast<float>(glyph->advance);
+        previous = codepoint;
+    }
+
+    out.width = std::max(out.width, penX);
+    out.height = penY + static_cast<float>(fontHeight_);
+}
@@ -0,0 +1,114 @@
+#include "GNEngine/core/ParticlePool.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GNENGINE_PARTICLE_SSE2 1
+#endif
+
+void ParticlePool::setCapacity(size_t capacity) {
+    capacity_ = capacity;
+    count_ = 0;
+
+    const size_t padded = (capacity + 3) & ~static_cast<size_t>(3);
+    for (auto* column : {&posX, &posY, &velX, &velY, &life, &invLifetime, &sizes, &colorR, &colorG, &colorB, &colorA}) {
+        column->assign(padded, 0.0f);
+    }
+}
+
+bool ParticlePool::spawn(float x, float y, float vx, float vy, float lifetime) {
+    if (count_ >= capacity_ || lifetime <= 0.0f) {
+        return false;
+    }
+    const size_t i = count_++;
+    posX[i] = x;
+    posY[i] = y;
+    velX[i] = vx;
+    velY[i] = vy;
+    life[i] = lifetime;
+    invLifetime[i] = 1.0f / lifetime;
+    return true;
+}
+
+void ParticlePool::simulate(const ParticleUpdateParams& params) {
+    size_t i = 0;
+
+#ifdef GNENGINE_PARTICLE_SSE2
+    const __m128 dt = _mm_set1_ps(params.deltaTime);
+    const __m128 gravityX = _mm_set1_ps(params.gravityX * params.deltaTime);
+    const __m128 gravityY = _mm_set1_ps(params.gravityY * params.deltaTime);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 endSize = _mm_set1_ps(params.endSize);
+    const __m128 sizeRange = _mm_set1_ps(params.startSize - params.endSize);
+    __m128 endColor[4], colorRange[4];
+    for (int c = 0; c < 4; ++c) {
+        endColor[c] = _mm_set1_ps(params.endColor[c]);
+        colorRange[c] = _mm_set1_ps(params.startColor[c] - params.endColor[c]);
+    }
+    float* colors[4] = {colorR.data(), colorG.data(), colorB.data(), colorA.data()};
+
+    // 용량이 4의 배수로 패딩되어 있으므로 마지막 묶음도 그대로 처리함. 패딩 칸의 값은 쓰이지 않음.
+    for (; i < count_; i += 4) {
+        __m128 vx = _mm_add_ps(_mm_loadu_ps(&velX[i]), gravityX);
+        __m128 vy = _mm_add_ps(_mm_loadu_ps(&velY[i]), gravityY);
+        _mm_storeu_ps(&velX[i], vx);
+        _mm_storeu_ps(&velY[i], vy);
+        _mm_storeu_ps(&posX[i], _mm_add_ps(_mm_loadu_ps(&posX[i]), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(&posY[i], _mm_add_ps(_mm_loadu_ps(&posY[i]), _mm_mul_ps(vy, dt)));
+
+        const __m128 remaining = _mm_sub_ps(_mm_loadu_ps(&life[i]), dt);
+        _mm_storeu_ps(&life[i], remaining);
+        const __m128 t = _mm_max_ps(_mm_mul_ps(remaining, _mm_loadu_ps(&invLifetime[i])), zero);
+
+        _mm_storeu_ps(&sizes[i], _mm_add_ps(endSize, _mm_mul_ps(sizeRange, t)));
+        for (int c = 0; c < 4; ++c) {
+            _mm_storeu_ps(colors[c] + i, _mm_add_ps(endColor[c], _mm_mul_ps(colorRange[c], t)));
+        }
+    }
+#endif
+
+    simulateScalar(params, i);
+    removeDead();
+}
+
+void ParticlePool::simulateScalar(const ParticleUpdateParams& params, size_t begin) {
+    const float dt = params.deltaTime;
+    for (size_t i = begin; i < count_; ++i) {
+        velX[i] += params.gravityX * dt;
+        velY[i] += params.gravityY * dt;
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+        life[i] -= dt;
+
+        const float t = std::max(life[i] * invLifetime[i], 0.0f);
+        sizes[i] = params.endSize + (params.startSize - params.endSize) * t;
+        colorR[i] = params.endColor[0] + (params.startColor[0] - params.endColor[0]) * t;
+        colorG[i] = params.endColor[1] + (params.startColor[1] - params.endColor[1]) * t;
+        colorB[i] = params.endColor[2] + (params.startColor[2] - params.endColor[2]) * t;
+        colorA[i] = params.endColor[3] + (params.startColor[3] - params.endColor[3]) * t;
+    }
+}
+
+/* 수명이 다한 파티클 자리에 마지막 파티클을 옮겨 채움. 순서는 유지하지 않음. */
+void ParticlePool::removeDead() {
+    size_t i = 0;
+    while (i < count_) {
+        if (life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        const size_t last = --count_;
+        posX[i] = posX[last];
+        posY[i] = posY[last];
+        velX[i] = velX[last];
+        velY[i] = velY[last];
+        life[i] = life[last];
+        invLifetime[i] = invLifetime[last];
+        sizes[i] = sizes[last];
+        colorR[i] = colorR[last];
+        colorG[i] = colorG[last];
+        colorB[i] = colorB[last];
+        colorA[i] = colorA[last];
+    }
+}
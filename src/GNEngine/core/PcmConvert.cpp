@@ -0,0 +1,137 @@
+#include "GNEngine/core/PcmConvert.h"
+
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GNENGINE_PCM_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GNENGINE_PCM_SSE2 1
+#endif
+
+namespace {
+
+constexpr float S16_SCALE = 32767.0f;
+
+inline int16_t floatToS16Scalar(float sample) {
+    const float scaled = std::clamp(sample * S16_SCALE, -32768.0f, 32767.0f);
+    return static_cast<int16_t>(scaled);
+}
+
+#ifdef GNENGINE_PCM_SSE2
+/* 4개의 float를 잘라 int32로 바꿈. 범위를 먼저 제한해 cvttps의 오버플로 값(INT_MIN)이 나오지 않게 함 */
+inline __m128i convert4(__m128 samples) {
+    const __m128 scaled = _mm_mul_ps(samples, _mm_set1_ps(S16_SCALE));
+    const __m128 clamped = _mm_min_ps(_mm_max_ps(scaled, _mm_set1_ps(-32768.0f)), _mm_set1_ps(32767.0f));
+    return _mm_cvttps_epi32(clamped);
+}
+
+/* LRLR 8개씩 두 묶음(8프레임)을 좌우로 나눔. 32비트 칸의 아래/위 16비트를 부호 확장한 뒤 다시 묶음 */
+inline void deinterleave8(__m128i a, __m128i b, int16_t* outLeft, int16_t* outRight) {
+    const __m128i leftA = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    const __m128i leftB = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    const __m128i rightA = _mm_srai_epi32(a, 16);
+    const __m128i rightB = _mm_srai_epi32(b, 16);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outLeft), _mm_packs_epi32(leftA, leftB));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outRight), _mm_packs_epi32(rightA, rightB));
+}
+#endif
+
+#ifdef GNENGINE_PCM_AVX2
+inline __m256i convert8(__m256 samples) {
+    const __m256 scaled = _mm256_mul_ps(samples, _mm256_set1_ps(S16_SCALE));
+    const __m256 clamped = _mm256_min_ps(_mm256_max_ps(scaled, _mm256_set1_ps(-32768.0f)), _mm256_set1_ps(32767.0f));
+    return _mm256_cvttps_epi32(clamped);
+}
+
+/* packs는 128비트 레인별로 묶으므로 64비트 단위로 자리를 바로잡음 */
+inline __m256i packs16(__m256i a, __m256i b) {
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+}
+
+inline void deinterleave16(__m256i a, __m256i b, int16_t* outLeft, int16_t* outRight) {
+    const __m256i leftA = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+    const __m256i leftB = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+    const __m256i rightA = _mm256_srai_epi32(a, 16);
+    const __m256i rightB = _mm256_srai_epi32(b, 16);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outLeft), packs16(leftA, leftB));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(outRight), packs16(rightA, rightB));
+}
+#endif
+
+} // namespace
+
+void PcmConvert::floatToS16(const float* in, int16_t* out, size_t count) {
+    size_t i = 0;
+
+#ifdef GNENGINE_PCM_AVX2
+    for (; i + 16 <= count; i += 16) {
+        const __m256i a = convert8(_mm256_loadu_ps(in + i));
+        const __m256i b = convert8(_mm256_loadu_ps(in + i + 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packs16(a, b));
+    }
+#endif
+#ifdef GNENGINE_PCM_SSE2
+    for (; i + 8 <= count; i += 8) {
+        const __m128i a = convert4(_mm_loadu_ps(in + i));
+        const __m128i b = convert4(_mm_loadu_ps(in + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(a, b));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        out[i] = floatToS16Scalar(in[i]);
+    }
+}
+
+void PcmConvert::deinterleaveStereo(const int16_t* in, int16_t* outLeft, int16_t* outRight, size_t frameCount) {
+    size_t i = 0;
+
+#ifdef GNENGINE_PCM_AVX2
+    for (; i + 16 <= frameCount; i += 16) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 2));
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 2 + 16));
+        deinterleave16(a, b, outLeft + i, outRight + i);
+    }
+#endif
+#ifdef GNENGINE_PCM_SSE2
+    for (; i + 8 <= frameCount; i += 8) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 2 + 8));
+        deinterleave8(a, b, outLeft + i, outRight + i);
+    }
+#endif
+
+    for (; i < frameCount; ++i) {
+        outLeft[i] = in[i * 2];
+        outRight[i] = in[i * 2 + 1];
+    }
+}
+
+void PcmConvert::floatStereoToS16Planar(const float* in, int16_t* outLeft, int16_t* outRight, size_t frameCount) {
+    size_t i = 0;
+
+#ifdef GNENGINE_PCM_AVX2
+    for (; i + 16 <= frameCount; i += 16) {
+        const float* src = in + i * 2;
+        const __m256i a = packs16(convert8(_mm256_loadu_ps(src)), convert8(_mm256_loadu_ps(src + 8)));
+        const __m256i b = packs16(convert8(_mm256_loadu_ps(src + 16)), convert8(_mm256_loadu_ps(src + 24)));
+        deinterleave16(a, b, outLeft + i, outRight + i);
+    }
+#endif
+#ifdef GNENGINE_PCM_SSE2
+    for (; i + 8 <= frameCount; i += 8) {
+        const float* src = in + i * 2;
+        const __m128i a = _mm_packs_epi32(convert4(_mm_loadu_ps(src)), convert4(_mm_loadu_ps(src + 4)));
+        const __m128i b = _mm_packs_epi32(convert4(_mm_loadu_ps(src + 8)), convert4(_mm_loadu_ps(src + 12)));
+        deinterleave8(a, b, outLeft + i, outRight + i);
+    }
+#endif
+
+    for (; i < frameCount; ++i) {
+        outLeft[i] = floatToS16Scalar(in[i * 2]);
+        outRight[i] = floatToS16Scalar(in[i * 2 + 1]);
+    }
+}
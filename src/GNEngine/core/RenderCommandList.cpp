@@ -0,0 +1,346 @@
+#include "GNEngine/core/RenderCommandList.h"
+
+#include <array>
+#include <fstream>
+#include <system_error>
+#include <unordered_map>
+
+namespace {
+    constexpr char FILE_MAGIC[4] = {'G', 'N', 'R', 'C'};
+    constexpr uint32_t FILE_VERSION = 2;
+
+    static_assert(sizeof(SDL_Vertex) == sizeof(float) * 8, "SDL_Vertex is saved as raw floats");
+
+    /* 파일에 저장되는 텍스처 표 항목. 뒤에 keyLength 바이트의 키가 이어짐. */
+    struct SerializedTextureInfo {
+        float width;
+        float height;
+        uint32_t keyLength;
+    };
+
+    /* 파일에 저장되는 명령 한 개. 포인터 대신 텍스처 표 인덱스를 가짐. */
+    struct SerializedCommand {
+        uint8_t type;
+        uint8_t layer;
+        uint8_t flip;
+        uint8_t hasSrcRect;
+        uint32_t textureSlot;
+        float srcRect[4];
+        float dstRect[4];
+        float color[4];
+        float sinAngle, cosAngle;
+        float originX, originY;
+        float zoom;
+        int32_t viewport[4];
+        uint32_t blendMode;
+        uint32_t vertexOffset;
+        uint32_t quadCount;
+    };
+
+    struct FileHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t textureCount;
+        uint32_t commandCount;
+        uint32_t vertexCount;
+    };
+}
+
+RenderCommandList::Command& RenderCommandList::push(Type type) {
+    Command& command = commands_.emplace_back();
+    command = {};
+    command.type = type;
+    command.layer = layer_;
+    command.flip = SDL_FLIP_NONE;
+    command.textureSlot = NO_TEXTURE;
+    command.color = {1.0f, 1.0f, 1.0f, 1.0f};
+    command.blendMode = SDL_BLENDMODE_NONE;
+    return command;
+}
+
+void RenderCommandList::drawSprite(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, SDL_FColor color, SDL_FlipMode flip) {
+    Command& command = push(Type::SPRITE);
+    command.texture = texture;
+    command.hasSrcRect = srcRect != nullptr;
+    if (srcRect) {
+        command.srcRect = *srcRect;
+    }
+    command.dstRect = dstRect;
+    command.color = color;
+    command.flip = flip;
+}
+
+void RenderCommandList::drawSpriteRotated(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, float sinAngle, float cosAngle,
+                                          float originX, float originY, SDL_FColor color, SDL_FlipMode flip) {
+    drawSprite(texture, srcRect, dstRect, color, flip);
+    Command& command = commands_.back();
+    command.type = Type::SPRITE_ROTATED;
+    command.sinAngle = sinAngle;
+    command.cosAngle = cosAngle;
+    command.originX = originX;
+    command.originY = originY;
+}
+
+void RenderCommandList::fillRect(const SDL_FRect& rect, SDL_FColor color) {
+    Command& command = push(Type::FILL_RECT);
+    command.dstRect = rect;
+    command.color = color;
+}
+
+void RenderCommandList::setBlendMode(SDL_BlendMode blendMode) {
+    push(Type::SET_BLEND_MODE).blendMode = blendMode;
+}
+
+void RenderCommandList::beginView(const SDL_Rect& viewport, float cameraX, float cameraY, float zoom) {
+    Command& command = push(Type::BEGIN_VIEW);
+    command.viewport = viewport;
+    command.originX = cameraX;
+    command.originY = cameraY;
+    command.zoom = zoom;
+}
+
+void RenderCommandList::endView() {
+    push(Type::END_VIEW);
+}
+
+void RenderCommandList::addCallback(std::function<void()> callback) {
+    push(Type::CUSTOM).callbackIndex = static_cast<uint32_t>(callbacks_.size());
+    callbacks_.push_back(std::move(callback));
+}
+
+void RenderCommandList::drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount, SDL_BlendMode blendMode) {
+    if (quadCount == 0) {
+        return;
+    }
+    Command& command = push(Type::GEOMETRY);
+    command.texture = texture;
+    command.blendMode = blendMode;
+    command.vertexOffset = static_cast<uint32_t>(vertices_.size());
+    command.quadCount = static_cast<uint32_t>(quadCount);
+    vertices_.insert(vertices_.end(), vertices, vertices + quadCount * 4);
+}
+
+/* 레이어별 명령 수를 세어 자리를 잡은 뒤 한 번에 채우는 계수 정렬임. 합친 뒤 콜백 인덱스와 정점 위치는 이 목록 기준으로 다시 매김. */
+void RenderCommandList::appendMergedByLayer(const std::vector<const RenderCommandList*>& lists) {
+    std::array<size_t, 257> layerStarts{};
+    size_t total = 0;
+    for (const RenderCommandList* list : lists) {
+        for (const Command& command : list->commands_) {
+            ++layerStarts[command.layer + 1];
+        }
+        total += list->commands_.size();
+    }
+    for (size_t layer = 1; layer < layerStarts.size(); ++layer) {
+        layerStarts[layer] += layerStarts[layer - 1];
+    }
+
+    const size_t base = commands_.size();
+    commands_.resize(base + total);
+    for (const RenderCommandList* list : lists) {
+        const uint32_t callbackBase = static_cast<uint32_t>(callbacks_.size());
+        const uint32_t vertexBase = static_cast<uint32_t>(vertices_.size());
+        callbacks_.insert(callbacks_.end(), list->callbacks_.begin(), list->callbacks_.end());
+        vertices_.insert(vertices_.end(), list->vertices_.begin(), list->vertices_.end());
+        for (const Command& command : list->commands_) {
+            Command& merged = commands_[base + layerStarts[command.layer]++];
+            merged = command;
+            if (merged.type == Type::CUSTOM) {
+                merged.callbackIndex += callbackBase;
+            } else if (merged.type == Type::GEOMETRY) {
+                merged.vertexOffset += vertexBase;
+            }
+        }
+    }
+}
+
+void RenderCommandList::clear() {
+    commands_.clear();
+    callbacks_.clear();
+    vertices_.clear();
+    textureInfos_.clear();
+    layer_ = 0;
+}
+
+bool RenderCommandList::saveToFile(const std::filesystem::path& path, const TextureKeyFunction& textureKey) const {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("RenderCommandList::saveToFile - Could not open %s", path.string().c_str());
+        return false;
+    }
+
+    // 바인딩된 텍스처는 포인터로, 불러온 뒤 바인딩하지 않은 명령은 원래 슬롯으로 새 텍스처 표 항목을 찾음
+    std::unordered_map<SDL_Texture*, uint32_t> textureSlots;
+    std::unordered_map<uint32_t, uint32_t> loadedSlots;
+    std::vector<TextureInfo> textureInfos;
+    std::vector<SerializedCommand> serialized(commands_.size());
+    for (size_t i = 0; i < commands_.size(); ++i) {
+        const Command& command = commands_[i];
+        SerializedCommand& out = serialized[i];
+        out = {};
+        out.type = static_cast<uint8_t>(command.type);
+        out.layer = command.layer;
+        out.flip = static_cast<uint8_t>(command.flip);
+        out.hasSrcRect = command.hasSrcRect ? 1 : 0;
+        out.textureSlot = NO_TEXTURE;
+        if (command.texture) {
+            auto [it, isInserted] = textureSlots.try_emplace(command.texture, static_cast<uint32_t>(textureInfos.size()));
+            if (isInserted) {
+                TextureInfo info = {0.0f, 0.0f, {}};
+                SDL_GetTextureSize(command.texture, &info.width, &info.height);
+                if (textureKey) {
+                    info.key = textureKey(command.texture);
+                }
+                textureInfos.push_back(std::move(info));
+            }
+            out.textureSlot = it->second;
+        } else if (command.textureSlot != NO_TEXTURE && command.textureSlot < textureInfos_.size()) {
+            auto [it, isInserted] = loadedSlots.try_emplace(command.textureSlot, static_cast<uint32_t>(textureInfos.size()));
+            if (isInserted) {
+                textureInfos.push_back(textureInfos_[command.textureSlot]);
+            }
+            out.textureSlot = it->second;
+        }
+        out.srcRect[0] = command.srcRect.x; out.srcRect[1] = command.srcRect.y; out.srcRect[2] = command.srcRect.w; out.srcRect[3] = command.srcRect.h;
+        out.dstRect[0] = command.dstRect.x; out.dstRect[1] = command.dstRect.y; out.dstRect[2] = command.dstRect.w; out.dstRect[3] = command.dstRect.h;
+        out.color[0] = command.color.r; out.color[1] = command.color.g; out.color[2] = command.color.b; out.color[3] = command.color.a;
+        out.sinAngle = command.sinAngle;
+        out.cosAngle = command.cosAngle;
+        out.originX = command.originX;
+        out.originY = command.originY;
+        out.zoom = command.zoom;
+        out.viewport[0] = command.viewport.x; out.viewport[1] = command.viewport.y; out.viewport[2] = command.viewport.w; out.viewport[3] = command.viewport.h;
+        out.blendMode = command.blendMode;
+        out.vertexOffset = command.vertexOffset;
+        out.quadCount = command.quadCount;
+    }
+
+    FileHeader header = {};
+    std::copy(std::begin(FILE_MAGIC), std::end(FILE_MAGIC), header.magic);
+    header.version = FILE_VERSION;
+    header.textureCount = static_cast<uint32_t>(textureInfos.size());
+    header.commandCount = static_cast<uint32_t>(serialized.size());
+    header.vertexCount = static_cast<uint32_t>(vertices_.size());
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const TextureInfo& info : textureInfos) {
+        const SerializedTextureInfo out = {info.width, info.height, static_cast<uint32_t>(info.key.size())};
+        file.write(reinterpret_cast<const char*>(&out), sizeof(out));
+        file.write(info.key.data(), static_cast<std::streamsize>(info.key.size()));
+    }
+    file.write(reinterpret_cast<const char*>(serialized.data()), static_cast<std::streamsize>(serialized.size() * sizeof(SerializedCommand)));
+    file.write(reinterpret_cast<const char*>(vertices_.data()), static_cast<std::streamsize>(vertices_.size() * sizeof(SDL_Vertex)));
+    if (!file) {
+        SDL_Log("RenderCommandList::saveToFile - Failed to write %s", path.string().c_str());
+        return false;
+    }
+    return true;
+}
+
+bool RenderCommandList::loadFromFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        SDL_Log("RenderCommandList::loadFromFile - Could not open %s", path.string().c_str());
+        return false;
+    }
+
+    FileHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || !std::equal(std::begin(FILE_MAGIC), std::end(FILE_MAGIC), header.magic) || header.version != FILE_VERSION) {
+        SDL_Log("RenderCommandList::loadFromFile - Not a render command dump (or unsupported version): %s", path.string().c_str());
+        return false;
+    }
+
+    // 헤더의 개수는 믿지 않고, 고정 크기 부분이 남은 파일 크기 안에 들어가는지 확인한 뒤에 버퍼를 잡음
+    std::error_code error;
+    const uint64_t fileSize = std::filesystem::file_size(path, error);
+    if (error || fileSize < sizeof(header)) {
+        SDL_Log("RenderCommandList::loadFromFile - Could not get the size of %s", path.string().c_str());
+        return false;
+    }
+    uint64_t remaining = fileSize - sizeof(header);
+    const uint64_t fixedSize = static_cast<uint64_t>(header.textureCount) * sizeof(SerializedTextureInfo)
+        + static_cast<uint64_t>(header.commandCount) * sizeof(SerializedCommand)
+        + static_cast<uint64_t>(header.vertexCount) * sizeof(SDL_Vertex);
+    if (fixedSize > remaining) {
+        SDL_Log("RenderCommandList::loadFromFile - Counts in the header exceed the file size: %s", path.string().c_str());
+        return false;
+    }
+    remaining -= fixedSize;
+
+    std::vector<TextureInfo> textureInfos(header.textureCount);
+    for (TextureInfo& info : textureInfos) {
+        SerializedTextureInfo in = {};
+        file.read(reinterpret_cast<char*>(&in), sizeof(in));
+        if (!file || in.keyLength > remaining) {
+            SDL_Log("RenderCommandList::loadFromFile - Truncated texture table: %s", path.string().c_str());
+            return false;
+        }
+        remaining -= in.keyLength;
+        info.width = in.width;
+        info.height = in.height;
+        info.key.resize(in.keyLength);
+        file.read(info.key.data(), static_cast<std::streamsize>(in.keyLength));
+    }
+    std::vector<SerializedCommand> serialized(header.commandCount);
+    std::vector<SDL_Vertex> vertices(header.vertexCount);
+    file.read(reinterpret_cast<char*>(serialized.data()), static_cast<std::streamsize>(serialized.size() * sizeof(SerializedCommand)));
+    file.read(reinterpret_cast<char*>(vertices.data()), static_cast<std::streamsize>(vertices.size() * sizeof(SDL_Vertex)));
+    if (!file) {
+        SDL_Log("RenderCommandList::loadFromFile - Truncated file: %s", path.string().c_str());
+        return false;
+    }
+
+    clear();
+    textureInfos_ = std::move(textureInfos);
+    vertices_ = std::move(vertices);
+    commands_.reserve(serialized.size());
+    for (const SerializedCommand& in : serialized) {
+        const bool isValidGeometry = in.type != static_cast<uint8_t>(Type::GEOMETRY)
+            || static_cast<uint64_t>(in.vertexOffset) + static_cast<uint64_t>(in.quadCount) * 4 <= vertices_.size();
+        if (in.type > static_cast<uint8_t>(Type::GEOMETRY) || !isValidGeometry) {
+            SDL_Log("RenderCommandList::loadFromFile - Invalid command (type %u) in %s", in.type, path.string().c_str());
+            clear();
+            return false;
+        }
+        layer_ = in.layer;
+        Command& command = push(static_cast<Type>(in.type));
+        command.flip = static_cast<SDL_FlipMode>(in.flip);
+        command.hasSrcRect = in.hasSrcRect != 0;
+        command.textureSlot = in.textureSlot < textureInfos_.size() ? in.textureSlot : NO_TEXTURE;
+        command.srcRect = {in.srcRect[0], in.srcRect[1], in.srcRect[2], in.srcRect[3]};
+        command.dstRect = {in.dstRect[0], in.dstRect[1], in.dstRect[2], in.dstRect[3]};
+        command.color = {in.color[0], in.color[1], in.color[2], in.color[3]};
+        command.sinAngle = in.sinAngle;
+        command.cosAngle = in.cosAngle;
+        command.originX = in.originX;
+        command.originY = in.originY;
+        command.zoom = in.zoom;
+        command.viewport = {in.viewport[0], in.viewport[1], in.viewport[2], in.viewport[3]};
+        command.blendMode = in.blendMode;
+        command.vertexOffset = in.vertexOffset;
+        command.quadCount = in.quadCount;
+        if (command.type == Type::CUSTOM) {
+            // 기록된 코드는 저장할 수 없으므로 빈 콜백으로 자리만 유지함
+            command.callbackIndex = static_cast<uint32_t>(callbacks_.size());
+            callbacks_.emplace_back([]() {});
+        }
+    }
+    layer_ = 0;
+    return true;
+}
+
+void RenderCommandList::bindTextures(const std::vector<SDL_Texture*>& textures) {
+    for (Command& command : commands_) {
+        if (command.textureSlot != NO_TEXTURE && command.textureSlot < textures.size()) {
+            command.texture = textures[command.textureSlot];
+        }
+    }
+}
+
+void RenderCommandList::bindTextures(const TextureResolver& resolver) {
+    std::vector<SDL_Texture*> textures(textureInfos_.size(), nullptr);
+    for (size_t i = 0; i < textureInfos_.size(); ++i) {
+        textures[i] = resolver(textureInfos_[i]);
+    }
+    bindTextures(textures);
+}
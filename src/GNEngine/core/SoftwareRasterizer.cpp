@@ -0,0 +1,405 @@
+#include "GNEngine/core/SoftwareRasterizer.h"
+#include "GNEngine/manager/JobManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GNENGINE_RASTER_SSE2 1
+#endif
+
+namespace {
+    uint32_t packPremultiplied(float r, float g, float b, float a) {
+        auto toByte = [](float value) {
+            return static_cast<uint32_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        };
+        return (toByte(a) << 24) | (toByte(r * a) << 16) | (toByte(g * a) << 8) | toByte(b * a);
+    }
+
+    /* 채널 8비트 두 개씩(0x00FF00FF) 묶어 두 픽셀을 f/256 비율로 섞음. */
+    uint32_t lerpPixel(uint32_t a, uint32_t b, uint32_t f) {
+        const uint32_t inv = 256 - f;
+        const uint32_t rb = (((a & 0x00FF00FF) * inv + (b & 0x00FF00FF) * f) >> 8) & 0x00FF00FF;
+        const uint32_t ag = (((a >> 8) & 0x00FF00FF) * inv + ((b >> 8) & 0x00FF00FF) * f) & 0xFF00FF00;
+        return rb | ag;
+    }
+
+    /* x / 255의 정수 근사. 0 ~ 255 * 255 범위에서 정확함. */
+    inline uint32_t div255(uint32_t x) {
+        x += 128;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    /*
+     * 프리멀티플라이드 알파 블렌딩: dst = src + dst * (255 - srcA) / 255.
+     * 덮이지 않은 픽셀은 src를 0으로 두면 dst가 그대로 남으므로 분기 없이 한 줄을 통째로 섞음.
+     */
+    void blendRow(uint32_t* dst, const uint32_t* src, int count) {
+        int i = 0;
+#ifdef GNENGINE_RASTER_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i max255 = _mm_set1_epi16(255);
+        const __m128i round128 = _mm_set1_epi16(128);
+        for (; i + 4 <= count; i += 4) {
+            const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+
+            auto blendHalf = [&](__m128i s16, __m128i d16) {
+                // BGRA 바이트 순서이므로 16비트 레인 3, 7이 알파임
+                __m128i alpha = _mm_shufflelo_epi16(s16, _MM_SHUFFLE(3, 3, 3, 3));
+                alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+                __m128i t = _mm_add_epi16(_mm_mullo_epi16(d16, _mm_sub_epi16(max255, alpha)), round128);
+                t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+                return _mm_add_epi16(s16, t);
+            };
+
+            const __m128i lo = blendHalf(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero));
+            const __m128i hi = blendHalf(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(lo, hi));
+        }
+#endif
+        for (; i < count; ++i) {
+            const uint32_t s = src[i];
+            const uint32_t inv = 255 - (s >> 24);
+            if (inv == 255) {
+                continue;
+            }
+            const uint32_t d = dst[i];
+            uint32_t result = 0;
+            for (int shift = 0; shift < 32; shift += 8) {
+                const uint32_t channel = ((s >> shift) & 0xFF) + div255(((d >> shift) & 0xFF) * inv);
+                result |= std::min(channel, 255u) << shift;
+            }
+            dst[i] = result;
+        }
+    }
+
+    /*
+     * 삼각형 변 하나의 에지 함수. 공유 변을 두 삼각형이 똑같은 float 연산으로 계산하도록
+     * 끝점을 사전순으로 정렬해 두고, 원래 방향과 다르면 sign으로 부호를 되돌림.
+     */
+    struct Edge {
+        float ax, ay, dx, dy;
+        float sign;
+
+        Edge(float x0, float y0, float x1, float y1, float orientation) {
+            const bool isSwapped = x1 < x0 || (x1 == x0 && y1 < y0);
+            if (isSwapped) {
+                std::swap(x0, x1);
+                std::swap(y0, y1);
+            }
+            ax = x0; ay = y0; dx = x1 - x0; dy = y1 - y0;
+            sign = isSwapped ? -orientation : orientation;
+        }
+
+        /* 픽셀 중심이 정확히 변 위에 있으면 sign이 양수인 쪽 삼각형만 그려 이중 블렌딩을 막음. */
+        bool contains(float value) const { return value > 0.0f || (value == 0.0f && sign > 0.0f); }
+    };
+}
+
+SoftwareRasterizer::SoftwareRasterizer(JobManager& jobManager, int width, int height)
+    : jobManager_(jobManager) {
+    resize(width, height);
+}
+
+SoftwareRasterizer::~SoftwareRasterizer() {
+    if (surface_) {
+        SDL_DestroySurface(surface_);
+    }
+}
+
+bool SoftwareRasterizer::resize(int width, int height) {
+    width_ = std::max(width, 1);
+    height_ = std::max(height, 1);
+    tilesX_ = (width_ + TILE_SIZE - 1) / TILE_SIZE;
+    tilesY_ = (height_ + TILE_SIZE - 1) / TILE_SIZE;
+    framebuffer_.assign(static_cast<size_t>(width_) * height_, clearColor_);
+    tileBins_.resize(static_cast<size_t>(tilesX_) * tilesY_);
+    clip_ = {0, 0, width_, height_};
+    viewportX_ = viewportY_ = 0;
+
+    if (surface_) {
+        SDL_DestroySurface(surface_);
+    }
+    surface_ = SDL_CreateSurfaceFrom(width_, height_, SDL_PIXELFORMAT_ARGB8888, framebuffer_.data(), getPitch());
+    if (!surface_) {
+        SDL_Log("SoftwareRasterizer::resize - Failed to create framebuffer surface: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+bool SoftwareRasterizer::addTexture(SDL_Texture* texture, SDL_Surface* surface) {
+    if (!surface) {
+        SDL_Log("SoftwareRasterizer::addTexture - Surface is null.");
+        return false;
+    }
+
+    SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+    if (!converted) {
+        SDL_Log("SoftwareRasterizer::addTexture - Failed to convert surface: %s", SDL_GetError());
+        return false;
+    }
+    // TextureManager가 불러온 텍스처는 이미 알파가 곱해져 있음
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    const bool isPremultiplied = texture && SDL_GetTextureBlendMode(texture, &blendMode) && blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    if ((!isPremultiplied && !SDL_PremultiplySurfaceAlpha(converted, false)) || !SDL_LockSurface(converted)) {
+        SDL_Log("SoftwareRasterizer::addTexture - Failed to premultiply surface: %s", SDL_GetError());
+        SDL_DestroySurface(converted);
+        return false;
+    }
+
+    RasterTexture& rasterTexture = textures_[texture];
+    rasterTexture.width = converted->w;
+    rasterTexture.height = converted->h;
+    rasterTexture.pixels.resize(static_cast<size_t>(converted->w) * converted->h);
+    for (int row = 0; row < converted->h; ++row) {
+        std::memcpy(rasterTexture.pixels.data() + static_cast<size_t>(row) * converted->w,
+                    static_cast<const uint8_t*>(converted->pixels) + static_cast<size_t>(row) * converted->pitch,
+                    static_cast<size_t>(converted->w) * sizeof(uint32_t));
+    }
+    SDL_UnlockSurface(converted);
+    SDL_DestroySurface(converted);
+
+    SDL_ScaleMode scaleMode = SDL_SCALEMODE_LINEAR;
+    if (texture) {
+        SDL_GetTextureScaleMode(texture, &scaleMode);
+    }
+    rasterTexture.isLinear = scaleMode != SDL_SCALEMODE_NEAREST;
+    return true;
+}
+
+void SoftwareRasterizer::removeTexture(SDL_Texture* texture) {
+    textures_.erase(texture);
+}
+
+void SoftwareRasterizer::beginFrame(SDL_Color clearColor) {
+    clearColor_ = packPremultiplied(clearColor.r / 255.0f, clearColor.g / 255.0f, clearColor.b / 255.0f, clearColor.a / 255.0f);
+    triangles_.clear();
+    for (auto& bin : tileBins_) {
+        bin.clear();
+    }
+    setViewport(nullptr);
+    missingTextureCount_ = 0;
+}
+
+void SoftwareRasterizer::setViewport(const SDL_Rect* viewport) {
+    const SDL_Rect full = {0, 0, width_, height_};
+    if (!viewport) {
+        viewportX_ = viewportY_ = 0;
+        clip_ = full;
+        return;
+    }
+    viewportX_ = viewport->x;
+    viewportY_ = viewport->y;
+    if (!SDL_GetRectIntersection(viewport, &full, &clip_)) {
+        clip_ = {0, 0, 0, 0};
+    }
+}
+
+void SoftwareRasterizer::submit(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount) {
+    const RasterTexture* rasterTexture = nullptr;
+    if (texture) {
+        auto it = textures_.find(texture);
+        if (it == textures_.end()) {
+            missingTextureCount_ += static_cast<size_t>(vertexCount / 4);
+            return;
+        }
+        rasterTexture = &it->second;
+    }
+
+    for (int base = 0; base + 3 < vertexCount; base += 4) {
+        addTriangle(rasterTexture, vertices[base], vertices[base + 1], vertices[base + 2]);
+        addTriangle(rasterTexture, vertices[base + 2], vertices[base + 3], vertices[base]);
+    }
+}
+
+void SoftwareRasterizer::addTriangle(const RasterTexture* texture, const SDL_Vertex& a, const SDL_Vertex& b, const SDL_Vertex& c) {
+    if (clip_.w <= 0 || clip_.h <= 0) {
+        return;
+    }
+
+    Triangle triangle;
+    triangle.texture = texture;
+    const SDL_Vertex* vertices[3] = {&a, &b, &c};
+    const float texWidth = texture ? static_cast<float>(texture->width) : 0.0f;
+    const float texHeight = texture ? static_cast<float>(texture->height) : 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        triangle.x[i] = vertices[i]->position.x + viewportX_;
+        triangle.y[i] = vertices[i]->position.y + viewportY_;
+        triangle.u[i] = vertices[i]->tex_coord.x * texWidth;
+        triangle.v[i] = vertices[i]->tex_coord.y * texHeight;
+    }
+    triangle.area = (triangle.x[1] - triangle.x[0]) * (triangle.y[2] - triangle.y[0]) -
+                    (triangle.y[1] - triangle.y[0]) * (triangle.x[2] - triangle.x[0]);
+    if (triangle.area == 0.0f) {
+        return;
+    }
+
+    const SDL_FColor& color = a.color;
+    const float alpha = std::clamp(color.a, 0.0f, 1.0f);
+    triangle.colorScale[0] = static_cast<uint32_t>(std::clamp(color.r, 0.0f, 1.0f) * alpha * 256.0f + 0.5f);
+    triangle.colorScale[1] = static_cast<uint32_t>(std::clamp(color.g, 0.0f, 1.0f) * alpha * 256.0f + 0.5f);
+    triangle.colorScale[2] = static_cast<uint32_t>(std::clamp(color.b, 0.0f, 1.0f) * alpha * 256.0f + 0.5f);
+    triangle.colorScale[3] = static_cast<uint32_t>(alpha * 256.0f + 0.5f);
+    triangle.isModulated = std::any_of(std::begin(triangle.colorScale), std::end(triangle.colorScale),
+                                       [](uint32_t scale) { return scale != 256; });
+    triangle.solidColor = packPremultiplied(color.r, color.g, color.b, color.a);
+    if (triangle.colorScale[3] == 0) {
+        return;
+    }
+
+    const float minX = std::min({triangle.x[0], triangle.x[1], triangle.x[2]});
+    const float minY = std::min({triangle.y[0], triangle.y[1], triangle.y[2]});
+    const float maxX = std::max({triangle.x[0], triangle.x[1], triangle.x[2]});
+    const float maxY = std::max({triangle.y[0], triangle.y[1], triangle.y[2]});
+    triangle.clipMinX = std::max(static_cast<int>(std::floor(minX)), clip_.x);
+    triangle.clipMinY = std::max(static_cast<int>(std::floor(minY)), clip_.y);
+    triangle.clipMaxX = std::min(static_cast<int>(std::ceil(maxX)), clip_.x + clip_.w) - 1;
+    triangle.clipMaxY = std::min(static_cast<int>(std::ceil(maxY)), clip_.y + clip_.h) - 1;
+    if (triangle.clipMinX > triangle.clipMaxX || triangle.clipMinY > triangle.clipMaxY) {
+        return;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(triangles_.size());
+    triangles_.push_back(triangle);
+    for (int tileY = triangle.clipMinY / TILE_SIZE; tileY <= triangle.clipMaxY / TILE_SIZE; ++tileY) {
+        for (int tileX = triangle.clipMinX / TILE_SIZE; tileX <= triangle.clipMaxX / TILE_SIZE; ++tileX) {
+            tileBins_[static_cast<size_t>(tileY) * tilesX_ + tileX].push_back(index);
+        }
+    }
+}
+
+void SoftwareRasterizer::endFrame() {
+    jobManager_.parallelFor(tileBins_.size(), [this](size_t tileIndex) { rasterizeTile(tileIndex); });
+
+    triangleCount_ = triangles_.size();
+    triangles_.clear();
+    for (auto& bin : tileBins_) {
+        bin.clear();
+    }
+}
+
+void SoftwareRasterizer::rasterizeTile(size_t tileIndex) {
+    const int tileMinX = static_cast<int>(tileIndex % tilesX_) * TILE_SIZE;
+    const int tileMinY = static_cast<int>(tileIndex / tilesX_) * TILE_SIZE;
+    const int tileMaxX = std::min(tileMinX + TILE_SIZE, width_) - 1;
+    const int tileMaxY = std::min(tileMinY + TILE_SIZE, height_) - 1;
+
+    for (int y = tileMinY; y <= tileMaxY; ++y) {
+        uint32_t* row = framebuffer_.data() + static_cast<size_t>(y) * width_;
+        std::fill(row + tileMinX, row + tileMaxX + 1, clearColor_);
+    }
+
+    for (uint32_t triangleIndex : tileBins_[tileIndex]) {
+        rasterizeTriangle(triangles_[triangleIndex], tileMinX, tileMinY, tileMaxX, tileMaxY);
+    }
+}
+
+/*
+ * 픽셀 중심에서 세 에지 함수를 계산해 안쪽 픽셀만 샘플링함.
+ * 한 줄의 결과를 행 버퍼에 모은 뒤(바깥 픽셀은 0) blendRow로 한꺼번에 섞음.
+ */
+void SoftwareRasterizer::rasterizeTriangle(const Triangle& triangle, int tileMinX, int tileMinY, int tileMaxX, int tileMaxY) {
+    const int minX = std::max(triangle.clipMinX, tileMinX);
+    const int minY = std::max(triangle.clipMinY, tileMinY);
+    const int maxX = std::min(triangle.clipMaxX, tileMaxX);
+    const int maxY = std::min(triangle.clipMaxY, tileMaxY);
+    if (minX > maxX || minY > maxY) {
+        return;
+    }
+
+    const float orientation = triangle.area > 0.0f ? 1.0f : -1.0f;
+    // edges[i]는 꼭짓점 i의 맞은편 변이며, 그 값이 꼭짓점 i의 무게중심 가중치가 됨
+    const Edge edges[3] = {
+        Edge(triangle.x[1], triangle.y[1], triangle.x[2], triangle.y[2], orientation),
+        Edge(triangle.x[2], triangle.y[2], triangle.x[0], triangle.y[0], orientation),
+        Edge(triangle.x[0], triangle.y[0], triangle.x[1], triangle.y[1], orientation),
+    };
+
+    uint32_t rowBuffer[TILE_SIZE];
+    const int spanWidth = maxX - minX + 1;
+
+    for (int y = minY; y <= maxY; ++y) {
+        const float centerY = y + 0.5f;
+        float rowTerms[3];
+        for (int i = 0; i < 3; ++i) {
+            rowTerms[i] = edges[i].dx * (centerY - edges[i].ay);
+        }
+
+        int firstCovered = spanWidth;
+        int lastCovered = -1;
+        for (int x = minX; x <= maxX; ++x) {
+            const float centerX = x + 0.5f;
+            float weights[3];
+            bool isInside = true;
+            for (int i = 0; i < 3; ++i) {
+                weights[i] = (rowTerms[i] - edges[i].dy * (centerX - edges[i].ax)) * edges[i].sign;
+                isInside = isInside && edges[i].contains(weights[i]);
+            }
+
+            const int column = x - minX;
+            if (!isInside) {
+                rowBuffer[column] = 0;
+                continue;
+            }
+
+            uint32_t color = triangle.solidColor;
+            if (triangle.texture) {
+                const float inverseSum = 1.0f / (weights[0] + weights[1] + weights[2]);
+                const float u = (weights[0] * triangle.u[0] + weights[1] * triangle.u[1] + weights[2] * triangle.u[2]) * inverseSum;
+                const float v = (weights[0] * triangle.v[0] + weights[1] * triangle.v[1] + weights[2] * triangle.v[2]) * inverseSum;
+                color = sample(triangle, u, v);
+            }
+            rowBuffer[column] = color;
+            firstCovered = std::min(firstCovered, column);
+            lastCovered = column;
+        }
+
+        if (lastCovered >= firstCovered) {
+            uint32_t* dst = framebuffer_.data() + static_cast<size_t>(y) * width_ + minX;
+            blendRow(dst + firstCovered, rowBuffer + firstCovered, lastCovered - firstCovered + 1);
+        }
+    }
+}
+
+/* u, v는 텍셀 단위임. 가장자리는 클램프하며, 결과에 정점 색을 곱함. */
+uint32_t SoftwareRasterizer::sample(const Triangle& triangle, float u, float v) const {
+    const RasterTexture& texture = *triangle.texture;
+    const int maxX = texture.width - 1;
+    const int maxY = texture.height - 1;
+
+    uint32_t texel;
+    if (texture.isLinear) {
+        const float fu = u - 0.5f;
+        const float fv = v - 0.5f;
+        const float floorU = std::floor(fu);
+        const float floorV = std::floor(fv);
+        const uint32_t fracX = static_cast<uint32_t>((fu - floorU) * 256.0f);
+        const uint32_t fracY = static_cast<uint32_t>((fv - floorV) * 256.0f);
+        const int x0 = std::clamp(static_cast<int>(floorU), 0, maxX);
+        const int y0 = std::clamp(static_cast<int>(floorV), 0, maxY);
+        const int x1 = std::min(x0 + 1, maxX);
+        const int y1 = std::min(y0 + 1, maxY);
+        const uint32_t* row0 = texture.pixels.data() + static_cast<size_t>(y0) * texture.width;
+        const uint32_t* row1 = texture.pixels.data() + static_cast<size_t>(y1) * texture.width;
+        texel = lerpPixel(lerpPixel(row0[x0], row0[x1], fracX), lerpPixel(row1[x0], row1[x1], fracX), fracY);
+    } else {
+        const int x = std::clamp(static_cast<int>(std::floor(u)), 0, maxX);
+        const int y = std::clamp(static_cast<int>(std::floor(v)), 0, maxY);
+        texel = texture.pixels[static_cast<size_t>(y) * texture.width + x];
+    }
+
+    if (!triangle.isModulated) {
+        return texel;
+    }
+    const uint32_t* scale = triangle.colorScale;
+    const uint32_t b = ((texel & 0xFF) * scale[2]) >> 8;
+    const uint32_t g = (((texel >> 8) & 0xFF) * scale[1]) >> 8;
+    const uint32_t r = (((texel >> 16) & 0xFF) * scale[0]) >> 8;
+    const uint32_t a = ((texel >> 24) * scale[3]) >> 8;
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
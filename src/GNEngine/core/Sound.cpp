@@ -8,18 +8,41 @@ Sound::Sound(ALuint monoBuffer, ALuint stereoBufferRight, bool isStereo)
       stereoBufferRight_(stereoBufferRight),
       isStereo_(isStereo) {}
 
+Sound::Sound()
+    : monoBuffer_(0),
+      stereoBufferRight_(0),
+      isStereo_(false),
+      state_(State::LOADING) {}
+
+/*
+ * 비동기로 디코딩된 버퍼를 채우고 READY로 바꿈.
+ */
+void Sound::setBuffers(ALuint monoBuffer, ALuint stereoBufferRight, bool isStereo) {
+    monoBuffer_ = monoBuffer;
+    stereoBufferRight_ = stereoBufferRight;
+    isStereo_ = isStereo;
+    state_ = State::READY;
+}
+
 /*
  * 소멸자에서 할당된 OpenAL 버퍼를 정리함.
  * monoBuffer_가 0이 아니면 항상 삭제를 시도함.
  * isStereo_가 true일 때만 stereoBufferRight_의 삭제를 시도함.
  */
 Sound::~Sound() {
+    releaseBuffers();
+}
+
+void Sound::releaseBuffers() {
     if (monoBuffer_ != 0 && alIsBuffer(monoBuffer_)) {
         alDeleteBuffers(1, &monoBuffer_);
     }
     if (isStereo_ && stereoBufferRight_ != 0 && alIsBuffer(stereoBufferRight_)) {
         alDeleteBuffers(1, &stereoBufferRight_);
     }
+    monoBuffer_ = 0;
+    stereoBufferRight_ = 0;
+    state_ = State::EVICTED;
 }
 
 
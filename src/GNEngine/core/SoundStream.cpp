@@ -0,0 +1,397 @@
+#include "GNEngine/core/SoundStream.h"
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+
+/* 구현부는 SoundManager.cpp에 있음 */
+#include "./dr_mp3.h"
+#include "./dr_wav.h"
+#include "./dr_flac.h"
+#define STB_VORBIS_HEADER_ONLY
+#include "./stb_vorbis.c"
+
+struct SoundStream::Decoder {
+    virtual ~Decoder() = default;
+    /* 인터리브된 s16 프레임을 최대 frames개 읽음. 파일 끝이면 요청보다 적게 돌려줌. */
+    virtual uint64_t read(int16_t* out, uint64_t frames) = 0;
+    virtual bool seek(uint64_t frame) = 0;
+
+    unsigned int channels = 0;
+    unsigned int sampleRate = 0;
+    uint64_t totalFrames = 0; /* 모르면 0 */
+};
+
+namespace {
+
+struct Mp3Decoder : SoundStream::Decoder {
+    drmp3 mp3{};
+    bool isOpen = false;
+
+    bool open(const std::string& path) {
+        isOpen = drmp3_init_file(&mp3, path.c_str(), NULL);
+        if (!isOpen) {
+            return false;
+        }
+        channels = mp3.channels;
+        sampleRate = mp3.sampleRate;
+        // 헤더만 훑어 프레임 수를 셈. 끝나면 처음으로 되돌려 둠
+        totalFrames = drmp3_get_pcm_frame_count(&mp3);
+        return drmp3_seek_to_pcm_frame(&mp3, 0);
+    }
+    ~Mp3Decoder() override { if (isOpen) drmp3_uninit(&mp3); }
+
+    uint64_t read(int16_t* out, uint64_t frames) override { return drmp3_read_pcm_frames_s16(&mp3, frames, out); }
+    bool seek(uint64_t frame) override { return drmp3_seek_to_pcm_frame(&mp3, frame); }
+};
+
+struct WavDecoder : SoundStream::Decoder {
+    drwav wav{};
+    bool isOpen = false;
+
+    bool open(const std::string& path) {
+        isOpen = drwav_init_file(&wav, path.c_str(), NULL);
+        if (!isOpen) {
+            return false;
+        }
+        channels = wav.channels;
+        sampleRate = wav.sampleRate;
+        totalFrames = wav.totalPCMFrameCount;
+        return true;
+    }
+    ~WavDecoder() override { if (isOpen) drwav_uninit(&wav); }
+
+    uint64_t read(int16_t* out, uint64_t frames) override { return drwav_read_pcm_frames_s16(&wav, frames, out); }
+    bool seek(uint64_t frame) override { return drwav_seek_to_pcm_frame(&wav, frame); }
+};
+
+struct FlacDecoder : SoundStream::Decoder {
+    drflac* flac = nullptr;
+
+    bool open(const std::string& path) {
+        flac = drflac_open_file(path.c_str(), NULL);
+        if (!flac) {
+            return false;
+        }
+        channels = flac->channels;
+        sampleRate = flac->sampleRate;
+        totalFrames = flac->totalPCMFrameCount;
+        return true;
+    }
+    ~FlacDecoder() override { if (flac) drflac_close(flac); }
+
+    uint64_t read(int16_t* out, uint64_t frames) override { return drflac_read_pcm_frames_s16(flac, frames, out); }
+    bool seek(uint64_t frame) override { return drflac_seek_to_pcm_frame(flac, frame); }
+};
+
+struct OggDecoder : SoundStream::Decoder {
+    stb_vorbis* vorbis = nullptr;
+
+    bool open(const std::string& path) {
+        int error = 0;
+        vorbis = stb_vorbis_open_filename(path.c_str(), &error, NULL);
+        if (!vorbis) {
+            return false;
+        }
+        stb_vorbis_info info = stb_vorbis_get_info(vorbis);
+        channels = static_cast<unsigned int>(info.channels);
+        sampleRate = info.sample_rate;
+        totalFrames = stb_vorbis_stream_length_in_samples(vorbis);
+        return true;
+    }
+    ~OggDecoder() override { if (vorbis) stb_vorbis_close(vorbis); }
+
+    uint64_t read(int16_t* out, uint64_t frames) override {
+        const int got = stb_vorbis_get_samples_short_interleaved(vorbis, static_cast<int>(channels), out, static_cast<int>(frames * channels));
+        return got > 0 ? static_cast<uint64_t>(got) : 0;
+    }
+    bool seek(uint64_t frame) override {
+        return frame == 0 ? stb_vorbis_seek_start(vorbis) != 0 : stb_vorbis_seek(vorbis, static_cast<unsigned int>(frame)) != 0;
+    }
+};
+
+template <typename T>
+std::unique_ptr<SoundStream::Decoder> openDecoder(const std::string& path) {
+    auto decoder = std::make_unique<T>();
+    if (!decoder->open(path)) {
+        return nullptr;
+    }
+    return decoder;
+}
+
+} // namespace
+
+std::shared_ptr<SoundStream> SoundStream::open(const std::filesystem::path& filePath) {
+    std::string ext = filePath.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    const std::string path = filePath.string();
+
+    std::unique_ptr<Decoder> decoder;
+    if (ext == ".mp3") { decoder = openDecoder<Mp3Decoder>(path); }
+    else if (ext == ".ogg") { decoder = openDecoder<OggDecoder>(path); }
+    else if (ext == ".flac") { decoder = openDecoder<FlacDecoder>(path); }
+    else if (ext == ".wav") { decoder = openDecoder<WavDecoder>(path); }
+    else {
+        std::cerr << "Unsupported stream format: " << ext << std::endl;
+        return nullptr;
+    }
+
+    if (!decoder) {
+        std::cerr << "Failed to open sound stream: " << path << std::endl;
+        return nullptr;
+    }
+    if (decoder->channels != 1 && decoder->channels != 2) {
+        std::cerr << "Unsupported stream channel count: " << decoder->channels << std::endl;
+        return nullptr;
+    }
+
+    std::shared_ptr<SoundStream> stream(new SoundStream(std::move(decoder)));
+    if (stream->sourceId_ == 0) {
+        return nullptr;
+    }
+    return stream;
+}
+
+SoundStream::SoundStream(std::unique_ptr<Decoder> decoder)
+    : decoder_(std::move(decoder)),
+      format_(decoder_->channels == 2 ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16),
+      pcm_(BUFFER_FRAMES * decoder_->channels) {
+    alGenSources(1, &sourceId_);
+    alGenBuffers(BUFFER_COUNT, buffers_);
+    if (alGetError() != AL_NO_ERROR) {
+        std::cerr << "Failed to generate OpenAL stream source." << std::endl;
+        releaseAL();
+        return;
+    }
+
+    // 배경 음악이므로 리스너 위치와 무관하게 들림. AL_LOOPING은 큐와 함께 쓸 수 없어 직접 되감음
+    alSourcei(sourceId_, AL_SOURCE_RELATIVE, AL_TRUE);
+    alSource3f(sourceId_, AL_POSITION, 0.0f, 0.0f, 0.0f);
+    alSourcef(sourceId_, AL_ROLLOFF_FACTOR, 0.0f);
+    alSourcei(sourceId_, AL_LOOPING, AL_FALSE);
+}
+
+SoundStream::~SoundStream() {
+    releaseAL();
+}
+
+void SoundStream::releaseAL() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ != 0) {
+        alSourceStop(sourceId_);
+        alSourcei(sourceId_, AL_BUFFER, 0);
+        alDeleteSources(1, &sourceId_);
+        sourceId_ = 0;
+    }
+    if (buffers_[0] != 0) {
+        alDeleteBuffers(BUFFER_COUNT, buffers_);
+        std::fill(std::begin(buffers_), std::end(buffers_), 0);
+    }
+    isActive_ = false;
+}
+
+bool SoundStream::play(float volume, bool loop) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0) {
+        return false;
+    }
+
+    volume_ = volume;
+    isLooping_ = loop;
+    alSourcef(sourceId_, AL_GAIN, volume);
+
+    rewindLocked(0);
+    if (queueCount_ == 0) {
+        return false;
+    }
+    isActive_ = true;
+    isPaused_ = false;
+    alSourcePlay(sourceId_);
+    return true;
+}
+
+void SoundStream::stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0) {
+        return;
+    }
+    alSourceStop(sourceId_);
+    alSourcei(sourceId_, AL_BUFFER, 0);
+    queueHead_ = 0;
+    queueCount_ = 0;
+    isActive_ = false;
+    isPaused_ = false;
+}
+
+void SoundStream::pause() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0 || !isActive_) {
+        return;
+    }
+    isPaused_ = true;
+    alSourcePause(sourceId_);
+}
+
+void SoundStream::resume() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0 || !isActive_ || !isPaused_) {
+        return;
+    }
+    isPaused_ = false;
+    alSourcePlay(sourceId_);
+}
+
+bool SoundStream::seek(double seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0) {
+        return false;
+    }
+
+    uint64_t frame = static_cast<uint64_t>(std::max(0.0, seconds) * decoder_->sampleRate);
+    if (decoder_->totalFrames > 0) {
+        frame = isLooping_ ? frame % decoder_->totalFrames : std::min(frame, decoder_->totalFrames);
+    }
+
+    rewindLocked(frame);
+    if (queueCount_ == 0) {
+        isActive_ = false;
+        return false;
+    }
+    if (isActive_ && !isPaused_) {
+        alSourcePlay(sourceId_);
+    }
+    return true;
+}
+
+void SoundStream::setVolume(float volume) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    volume_ = volume;
+    if (sourceId_ != 0) {
+        alSourcef(sourceId_, AL_GAIN, volume);
+    }
+}
+
+void SoundStream::setLooping(bool loop) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isLooping_ = loop;
+}
+
+bool SoundStream::isPlaying() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return isActive_ && !isPaused_;
+}
+
+bool SoundStream::isPaused() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return isActive_ && isPaused_;
+}
+
+bool SoundStream::isLooping() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return isLooping_;
+}
+
+double SoundStream::getPosition() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0 || queueCount_ == 0 || decoder_->sampleRate == 0) {
+        return 0.0;
+    }
+
+    ALint sampleOffset = 0;
+    alGetSourcei(sourceId_, AL_SAMPLE_OFFSET, &sampleOffset);
+    uint64_t frame = queuedStartFrames_[queueHead_] + static_cast<uint64_t>(std::max(sampleOffset, 0));
+    if (decoder_->totalFrames > 0) {
+        // 반복하면서 버퍼 중간에서 처음으로 넘어간 경우
+        frame %= decoder_->totalFrames;
+    }
+    return static_cast<double>(frame) / decoder_->sampleRate;
+}
+
+double SoundStream::getDuration() const {
+    if (decoder_->sampleRate == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(decoder_->totalFrames) / decoder_->sampleRate;
+}
+
+void SoundStream::update() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (sourceId_ == 0 || !isActive_ || isPaused_) {
+        return;
+    }
+
+    ALint processed = 0;
+    alGetSourcei(sourceId_, AL_BUFFERS_PROCESSED, &processed);
+    while (processed-- > 0) {
+        ALuint buffer = 0;
+        alSourceUnqueueBuffers(sourceId_, 1, &buffer);
+        queueHead_ = (queueHead_ + 1) % BUFFER_COUNT;
+        --queueCount_;
+
+        if (!isEndOfStream_ && fillBufferLocked(buffer)) {
+            alSourceQueueBuffers(sourceId_, 1, &buffer);
+        }
+    }
+
+    ALint state = AL_STOPPED;
+    alGetSourcei(sourceId_, AL_SOURCE_STATE, &state);
+    if (state != AL_PLAYING) {
+        if (queueCount_ > 0) {
+            // 디코딩이 늦어 큐가 비었다가 다시 채워진 경우. 소스는 멈춰 있으므로 다시 재생함
+            alSourcePlay(sourceId_);
+        } else {
+            isActive_ = false;
+        }
+    }
+}
+
+void SoundStream::rewindLocked(uint64_t frame) {
+    alSourceStop(sourceId_);
+    alSourcei(sourceId_, AL_BUFFER, 0);
+    queueHead_ = 0;
+    queueCount_ = 0;
+
+    isEndOfStream_ = !decoder_->seek(frame);
+    cursorFrame_ = frame;
+
+    for (ALuint buffer : buffers_) {
+        if (isEndOfStream_ || !fillBufferLocked(buffer)) {
+            break;
+        }
+        alSourceQueueBuffers(sourceId_, 1, &buffer);
+    }
+}
+
+bool SoundStream::fillBufferLocked(ALuint buffer) {
+    const unsigned int channels = decoder_->channels;
+    const uint64_t startFrame = cursorFrame_;
+    uint64_t filled = 0;
+    bool hasWrapped = false;
+
+    while (filled < BUFFER_FRAMES) {
+        const uint64_t got = decoder_->read(pcm_.data() + filled * channels, BUFFER_FRAMES - filled);
+        filled += got;
+        cursorFrame_ += got;
+        if (filled == BUFFER_FRAMES) {
+            break;
+        }
+
+        // 파일 끝. 반복이면 같은 버퍼 안에서 처음부터 이어 채움. 되감자마자 또 끝이면 빈 파일로 보고 멈춤
+        if (!isLooping_ || (hasWrapped && got == 0) || !decoder_->seek(0)) {
+            isEndOfStream_ = true;
+            break;
+        }
+        hasWrapped = got == 0;
+        cursorFrame_ = 0;
+    }
+
+    if (filled == 0) {
+        return false;
+    }
+
+    alBufferData(buffer, format_, pcm_.data(), static_cast<ALsizei>(filled * channels * sizeof(int16_t)), static_cast<ALsizei>(decoder_->sampleRate));
+    const int tail = (queueHead_ + queueCount_) % BUFFER_COUNT;
+    queuedStartFrames_[tail] = startFrame;
+    ++queueCount_;
+    return true;
+}
@@ -0,0 +1,109 @@
+#include "GNEngine/core/SpriteBatch.h"
+#include "GNEngine/core/SoftwareRasterizer.h"
+
+#include <utility>
+
+SpriteBatch::SpriteBatch(SDL_Renderer* renderer)
+    : renderer_(renderer) {
+    vertices_.reserve(MAX_QUADS * 4);
+    indices_.reserve(MAX_QUADS * 6);
+    for (size_t quad = 0; quad < MAX_QUADS; ++quad) {
+        const int base = static_cast<int>(quad * 4);
+        indices_.insert(indices_.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+}
+
+void SpriteBatch::prepareQuad(SDL_Texture* texture, const SDL_FRect* srcRect, SDL_FlipMode flip, float& u0, float& v0, float& u1, float& v1) {
+    if (texture != currentTexture_ || vertices_.size() >= MAX_QUADS * 4) {
+        flush();
+        currentTexture_ = texture;
+        currentTextureWidth_ = currentTextureHeight_ = 1.0f;
+        isCurrentPremultiplied_ = false;
+        if (texture) {
+            SDL_GetTextureSize(texture, &currentTextureWidth_, &currentTextureHeight_);
+            SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+            isCurrentPremultiplied_ = SDL_GetTextureBlendMode(texture, &blendMode)
+                && (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED || blendMode == SDL_BLENDMODE_ADD_PREMULTIPLIED);
+        }
+    }
+
+    u0 = 0.0f; v0 = 0.0f; u1 = 1.0f; v1 = 1.0f;
+    if (srcRect && texture) {
+        u0 = srcRect->x / currentTextureWidth_;
+        v0 = srcRect->y / currentTextureHeight_;
+        u1 = (srcRect->x + srcRect->w) / currentTextureWidth_;
+        v1 = (srcRect->y + srcRect->h) / currentTextureHeight_;
+    }
+    if (flip & SDL_FLIP_HORIZONTAL) std::swap(u0, u1);
+    if (flip & SDL_FLIP_VERTICAL) std::swap(v0, v1);
+}
+
+void SpriteBatch::draw(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, SDL_FColor color, SDL_FlipMode flip) {
+    float u0, v0, u1, v1;
+    prepareQuad(texture, srcRect, flip, u0, v0, u1, v1);
+    color = toVertexColor(color);
+
+    const float x0 = dstRect.x;
+    const float y0 = dstRect.y;
+    const float x1 = dstRect.x + dstRect.w;
+    const float y1 = dstRect.y + dstRect.h;
+
+    vertices_.push_back({{x0, y0}, color, {u0, v0}});
+    vertices_.push_back({{x1, y0}, color, {u1, v0}});
+    vertices_.push_back({{x1, y1}, color, {u1, v1}});
+    vertices_.push_back({{x0, y1}, color, {u0, v1}});
+}
+
+void SpriteBatch::drawRotated(SDL_Texture* texture, const SDL_FRect* srcRect, const SDL_FRect& dstRect, float sinAngle, float cosAngle,
+                              float originX, float originY, SDL_FColor color, SDL_FlipMode flip) {
+    float u0, v0, u1, v1;
+    prepareQuad(texture, srcRect, flip, u0, v0, u1, v1);
+    color = toVertexColor(color);
+
+    // 회전 중심 기준의 모서리 좌표. 화면 좌표계(y 아래)에서 양의 각도는 시계 방향 회전임 (SDL_RenderTextureRotated와 같음)
+    const float left = dstRect.x - originX;
+    const float top = dstRect.y - originY;
+    const float right = left + dstRect.w;
+    const float bottom = top + dstRect.h;
+
+    auto rotate = [&](float localX, float localY) -> SDL_FPoint {
+        return {originX + localX * cosAngle - localY * sinAngle, originY + localX * sinAngle + localY * cosAngle};
+    };
+
+    vertices_.push_back({rotate(left, top), color, {u0, v0}});
+    vertices_.push_back({rotate(right, top), color, {u1, v0}});
+    vertices_.push_back({rotate(right, bottom), color, {u1, v1}});
+    vertices_.push_back({rotate(left, bottom), color, {u0, v1}});
+}
+
+void SpriteBatch::drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount) {
+    for (size_t quad = 0; quad < quadCount; ++quad) {
+        float u0, v0, u1, v1;
+        prepareQuad(texture, nullptr, SDL_FLIP_NONE, u0, v0, u1, v1); // 텍스처 전환과 버퍼 가득 참만 처리함. UV는 정점 것을 씀
+        for (int corner = 0; corner < 4; ++corner) {
+            SDL_Vertex vertex = vertices[quad * 4 + corner];
+            vertex.color = toVertexColor(vertex.color);
+            vertices_.push_back(vertex);
+        }
+    }
+}
+
+/* 텍스처가 파괴된 뒤 같은 주소로 다시 만들어질 수 있으므로, flush 후에는 현재 텍스처 정보도 잊음. */
+void SpriteBatch::flush() {
+    if (vertices_.empty()) {
+        currentTexture_ = nullptr;
+        return;
+    }
+
+    const int vertexCount = static_cast<int>(vertices_.size());
+    if (rasterizer_) {
+        rasterizer_->submit(currentTexture_, vertices_.data(), vertexCount);
+    } else if (!SDL_RenderGeometry(renderer_, currentTexture_, vertices_.data(), vertexCount, indices_.data(), vertexCount / 4 * 6)) {
+        SDL_Log("SpriteBatch::flush - Failed to render geometry: %s", SDL_GetError());
+    }
+
+    ++drawCallCount_;
+    quadCount_ += vertices_.size() / 4;
+    vertices_.clear();
+    currentTexture_ = nullptr;
+}
@@ -7,13 +7,134 @@
 #include "./json.hpp"
 
 #include "GNEngine/manager/TextureManager.h"
+#include "GNEngine/core/MappedFile.h"
+
+// animation_generated 파일은 이 명령어로 생성.
+//./lib/flatbuffers/flatc.exe -c -o "include/GNEngine/flatbuffers_generated" "asset/text/fbs/animation.fbs"
+#include "GNEngine/flatbuffers_generated/animation_generated.h"
 
 /*
- * @brief JSON 파일을 로드하여 애니메이션 데이터를 파싱하고 캐시에 저장함.
- * @param jsonPath - 애니메이션 데이터가 정의된 JSON 파일의 경로.
+ * @brief 애니메이션 파일을 로드하여 캐시에 저장함.
+ *        .gnanim이면 바이너리로 읽고, .json이면 옆에 더 최신인 같은 이름의 .gnanim이 있을 때 그것을 대신 읽음.
+ *        바이너리가 없거나 읽지 못하면 JSON을 파싱함.
+ * @param path - 애니메이션 데이터가 정의된 JSON 또는 .gnanim 파일의 경로.
  * @return 로딩 및 파싱 성공 시 true, 실패 시 false.
  */
-bool AnimationManager::loadAnimation(const std::filesystem::path& jsonPath) {
+bool AnimationManager::loadAnimation(const std::filesystem::path& path) {
+    if (path.extension() == BINARY_EXTENSION) {
+        return loadAnimationBinary(path);
+    }
+
+    std::filesystem::path binaryPath = path;
+    binaryPath.replace_extension(BINARY_EXTENSION);
+    std::error_code error;
+    if (std::filesystem::exists(binaryPath, error)
+        && std::filesystem::last_write_time(binaryPath, error) >= std::filesystem::last_write_time(path, error)
+        && !error && loadAnimationBinary(binaryPath)) {
+        return true;
+    }
+
+    std::vector<AnimationDesc> descs;
+    if (!parseAnimationJson(path, descs)) {
+        return false;
+    }
+    for (const AnimationDesc& desc : descs) {
+        auto animation = std::make_shared<Animation>(path.parent_path() / desc.spritesheetPath, desc.loop);
+        for (size_t i = 0; i < desc.frames.size(); ++i) {
+            animation->addFrame(desc.frames[i], desc.durations[i], desc.events[i]);
+        }
+        cacheAnimation(desc.name, std::move(animation), path);
+    }
+    return true;
+}
+
+/*
+ * @brief convertJsonToBinary로 만든 .gnanim 파일을 메모리 매핑해서 읽음. 파싱 없이 검증 후 프레임 배열을 바로 복사함.
+ * @return 파일을 열지 못했거나 검증에 실패하면 false.
+ */
+bool AnimationManager::loadAnimationBinary(const std::filesystem::path& binaryPath) {
+    MappedFile file;
+    if (!file.open(binaryPath)) {
+        return false;
+    }
+
+    flatbuffers::Verifier verifier(file.getData(), file.getSize());
+    if (!GNEngine::anim::VerifyAnimationSetBuffer(verifier)) {
+        std::cerr << "Error: Invalid animation binary file: " << binaryPath << std::endl;
+        return false;
+    }
+
+    const auto* clips = GNEngine::anim::GetAnimationSet(file.getData())->clips();
+    if (!clips) {
+        return true;
+    }
+    for (const auto* clip : *clips) {
+        if (!clip->name() || !clip->spritesheet_path() || !clip->frames()) {
+            std::cerr << "Error: Malformed clip in " << binaryPath << "." << std::endl;
+            continue;
+        }
+
+        auto animation = std::make_shared<Animation>(binaryPath.parent_path() / clip->spritesheet_path()->str(), clip->loop());
+        std::vector<std::string> events(clip->frames()->size());
+        if (clip->events()) {
+            for (const auto* event : *clip->events()) {
+                if (event->name() && event->frame() >= 0 && static_cast<size_t>(event->frame()) < events.size()) {
+                    events[event->frame()] = event->name()->str();
+                }
+            }
+        }
+        for (flatbuffers::uoffset_t i = 0; i < clip->frames()->size(); ++i) {
+            const auto* frame = clip->frames()->Get(i);
+            animation->addFrame({frame->x(), frame->y(), frame->w(), frame->h()}, frame->duration_ms(), events[i]);
+        }
+        cacheAnimation(clip->name()->str(), std::move(animation), binaryPath);
+    }
+    return true;
+}
+
+/*
+ * @brief 애니메이션 JSON을 .gnanim 바이너리로 변환함. 스프라이트 시트 경로는 JSON에 적힌 상대 경로 그대로 저장하므로
+ *        결과 파일은 JSON과 같은 디렉터리에 두어야 함. 오프라인 변환 도구(AnimConvert)가 사용함.
+ */
+bool AnimationManager::convertJsonToBinary(const std::filesystem::path& jsonPath, const std::filesystem::path& binaryPath) {
+    std::vector<AnimationDesc> descs;
+    if (!parseAnimationJson(jsonPath, descs)) {
+        return false;
+    }
+
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<GNEngine::anim::Clip>> clips;
+    std::vector<GNEngine::anim::Frame> frames;
+    std::vector<flatbuffers::Offset<GNEngine::anim::FrameEvent>> events;
+    for (const AnimationDesc& desc : descs) {
+        frames.clear();
+        events.clear();
+        for (size_t i = 0; i < desc.frames.size(); ++i) {
+            const SDL_Rect& rect = desc.frames[i];
+            frames.emplace_back(rect.x, rect.y, rect.w, rect.h, desc.durations[i]);
+            if (!desc.events[i].empty()) {
+                events.push_back(GNEngine::anim::CreateFrameEventDirect(builder, static_cast<int32_t>(i), desc.events[i].c_str()));
+            }
+        }
+        clips.push_back(GNEngine::anim::CreateClipDirect(builder, desc.name.c_str(), desc.spritesheetPath.c_str(), desc.loop, &frames,
+                                                         events.empty() ? nullptr : &events));
+    }
+    GNEngine::anim::FinishAnimationSetBuffer(builder, GNEngine::anim::CreateAnimationSetDirect(builder, &clips));
+
+    std::ofstream outFile(binaryPath, std::ios::binary);
+    outFile.write(reinterpret_cast<const char*>(builder.GetBufferPointer()), builder.GetSize());
+    if (!outFile) {
+        std::cerr << "Error: Could not write animation binary file: " << binaryPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/*
+ * @brief JSON 파일을 파싱하여 애니메이션 정의를 descs에 모음. 잘못된 애니메이션은 경고를 남기고 건너뜀.
+ * @return 파일을 열지 못했거나 JSON 구조가 잘못되었으면 false.
+ */
+bool AnimationManager::parseAnimationJson(const std::filesystem::path& jsonPath, std::vector<AnimationDesc>& descs) {
     std::ifstream file(jsonPath);
     if (!file.is_open()) {
         std::cerr << "Error: Could not open animation JSON file: " << jsonPath << std::endl;
@@ -30,33 +151,27 @@ bool AnimationManager::loadAnimation(const std::filesystem::path& jsonPath) {
 
     // JSON 구조에 따라 애니메이션 데이터를 파싱
     // 예시: {"animations": {"run": {...}, "idle": {...}}}
+    // 프레임에 "event": "footstep"처럼 이벤트 이름을 달 수 있음
     if (!json.contains("animations") || !json["animations"].is_object()) {
         std::cerr << "Error: JSON file does not contain 'animations' object: " << jsonPath << std::endl;
         return false;
     }
 
     for (auto& [animName, animData] : json["animations"].items()) {
-        if (animationCache_.count(animName)) {
-            std::cerr << "Warning: Animation '" << animName << "' already loaded. Skipping." << std::endl;
-            continue;
-        }
-
-        std::filesystem::path spritesheetPath;
-        bool loop = true;
+        AnimationDesc desc;
+        desc.name = animName;
 
         if (animData.contains("spritesheetPath") && animData["spritesheetPath"].is_string()) {
-            spritesheetPath = jsonPath.parent_path() / animData["spritesheetPath"].get<std::string>();
+            desc.spritesheetPath = animData["spritesheetPath"].get<std::string>();
         } else {
             std::cerr << "Error: Animation '" << animName << "' in " << jsonPath << " missing 'spritesheetPath'." << std::endl;
             continue;
         }
 
         if (animData.contains("loop") && animData["loop"].is_boolean()) {
-            loop = animData["loop"].get<bool>();
+            desc.loop = animData["loop"].get<bool>();
         }
 
-        auto animation = std::make_shared<Animation>(spritesheetPath, loop);
-
         if (animData.contains("frames") && animData["frames"].is_array()) {
             for (const auto& frameData : animData["frames"]) {
                 if (frameData.contains("x") && frameData["x"].is_number()
@@ -65,14 +180,14 @@ bool AnimationManager::loadAnimation(const std::filesystem::path& jsonPath) {
                     && frameData.contains("h") && frameData["h"].is_number()
                     && frameData.contains("duration") && frameData["duration"].is_number()) {
 
-                    SDL_Rect rect = {
+                    desc.frames.push_back({
                         frameData["x"].get<int>(),
                         frameData["y"].get<int>(),
                         frameData["w"].get<int>(),
                         frameData["h"].get<int>()
-                    };
-                    int duration = frameData["duration"].get<int>();
-                    animation->addFrame(rect, duration);
+                    });
+                    desc.durations.push_back(frameData["duration"].get<int>());
+                    desc.events.push_back(frameData.contains("event") && frameData["event"].is_string() ? frameData["event"].get<std::string>() : std::string());
                 } else {
                     std::cerr << "Error: Malformed frame data for animation '" << animName << "' in " << jsonPath << "." << std::endl;
                 }
@@ -82,16 +197,27 @@ bool AnimationManager::loadAnimation(const std::filesystem::path& jsonPath) {
             continue;
         }
 
-        if (animation->getFrameCount() > 0) {
-            animationCache_[animName] = animation;
-        } else {
-            std::cerr << "Warning: Animation '" << animName << "' in " << jsonPath << " has no frames. Not caching." << std::endl;
-        }
+        descs.push_back(std::move(desc));
     }
 
     return true;
 }
 
+/* 프레임이 있는 애니메이션을 AnimationTable에 등록하고 캐시에 넣음. 이미 같은 이름이 있으면 건너뜀. */
+void AnimationManager::cacheAnimation(const std::string& animName, std::shared_ptr<Animation> animation, const std::filesystem::path& sourcePath) {
+    if (animationCache_.count(animName)) {
+        std::cerr << "Warning: Animation '" << animName << "' already loaded. Skipping." << std::endl;
+        return;
+    }
+    if (animation->getFrameCount() == 0) {
+        std::cerr << "Warning: Animation '" << animName << "' in " << sourcePath << " has no frames. Not caching." << std::endl;
+        return;
+    }
+
+    animation->getHandle(); // 프레임을 AnimationTable에 펼쳐 둠
+    animationCache_[animName] = std::move(animation);
+}
+
 /*
  * @brief 캐시에서 애니메이션 데이터를 가져옴.
  * @param animationName - 가져올 애니메이션의 이름 (JSON 파일에 정의된 키).
@@ -106,8 +232,213 @@ std::shared_ptr<Animation> AnimationManager::getAnimation(const std::string& ani
     return nullptr;
 }
 
+AnimationHandle AnimationManager::getAnimationHandle(const std::string& animationName) {
+    auto animation = getAnimation(animationName);
+    return animation ? animation->getHandle() : INVALID_ANIMATION_HANDLE;
+}
+
 void AnimationManager::setScaleModeOfAnimation(const std::string& animationName, SDL_ScaleMode scaleMode) {
     if(!SDL_SetTextureScaleMode(textureManager_.getTexture(getAnimation(animationName)->getTexturePath())->sdlTexture_, scaleMode)) {
         SDL_Log("AnimationManager::setScaleModeOfAnimation - Failed to set texture scale mode. (%s) Reason : %s", animationName, SDL_GetError());
     }
-}
\ No newline at end of file
+}
+
+namespace {
+
+bool parseParameterSource(const std::string& text, AnimationStateMachine::ParameterSource& source) {
+    using Source = AnimationStateMachine::ParameterSource;
+    static const std::pair<const char*, Source> SOURCES[] = {
+        {"none", Source::NONE}, {"speed", Source::SPEED},
+        {"velocityX", Source::VELOCITY_X}, {"velocityY", Source::VELOCITY_Y}, {"absVelocityX", Source::ABS_VELOCITY_X},
+        {"accelerationX", Source::ACCELERATION_X}, {"accelerationY", Source::ACCELERATION_Y},
+    };
+    for (const auto& [name, value] : SOURCES) {
+        if (text == name) {
+            source = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parseComparison(const std::string& text, AnimationStateMachine::Comparison& comparison) {
+    using Comparison = AnimationStateMachine::Comparison;
+    if (text == ">") { comparison = Comparison::GREATER; return true; }
+    if (text == ">=") { comparison = Comparison::GREATER_EQUAL; return true; }
+    if (text == "<") { comparison = Comparison::LESS; return true; }
+    if (text == "<=") { comparison = Comparison::LESS_EQUAL; return true; }
+    return false;
+}
+
+} // namespace
+
+/*
+ * @brief 상태 머신 JSON을 읽어 정의를 만들고 보관함.
+ *        예시: {"stateMachines": {"player": {"parameters": [{"name": "speed", "source": "speed"}], "events": ["jump"],
+ *              "states": [{"name": "idle", "animation": "idle"}, ...], "initialState": "idle",
+ *              "transitions": [{"from": "idle", "to": "walk", "parameter": "speed", "op": ">", "value": 0.1},
+ *                              {"from": "*", "to": "jump", "event": "jump"}, {"from": "jump", "to": "idle", "finished": true}]}}}
+ *        전환은 적힌 순서대로 검사하며, "minTime"(초)을 주면 현재 상태에 그만큼 머문 뒤에만 전환함.
+ *        잘못된 상태나 전환은 경고를 남기고 건너뜀.
+ */
+bool AnimationManager::loadStateMachine(const std::filesystem::path& jsonPath) {
+    std::ifstream file(jsonPath);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open state machine JSON file: " << jsonPath << std::endl;
+        return false;
+    }
+
+    nlohmann::json json;
+    try {
+        json = nlohmann::json::parse(file);
+    } catch (const nlohmann::json::parse_error& error) {
+        std::cerr << "Error parsing state machine JSON file " << jsonPath << ": " << error.what() << std::endl;
+        return false;
+    }
+
+    if (!json.contains("stateMachines") || !json["stateMachines"].is_object()) {
+        std::cerr << "Error: JSON file does not contain 'stateMachines' object: " << jsonPath << std::endl;
+        return false;
+    }
+
+    const AnimationTable& table = AnimationTable::instance();
+    for (auto& [machineName, machineData] : json["stateMachines"].items()) {
+        if (stateMachines_.count(machineName)) {
+            std::cerr << "Warning: State machine '" << machineName << "' already loaded. Skipping." << std::endl;
+            continue;
+        }
+        auto machine = std::make_unique<AnimationStateMachine>(machineName);
+
+        if (machineData.contains("parameters") && machineData["parameters"].is_array()) {
+            for (const auto& parameterData : machineData["parameters"]) {
+                if (!parameterData.contains("name") || !parameterData["name"].is_string()) {
+                    std::cerr << "Error: Parameter without 'name' in state machine '" << machineName << "'." << std::endl;
+                    continue;
+                }
+                if ((parameterData.contains("source") && !parameterData["source"].is_string())
+                    || (parameterData.contains("default") && !parameterData["default"].is_number())) {
+                    std::cerr << "Error: Malformed parameter '" << parameterData["name"].get<std::string>() << "' in state machine '" << machineName << "'." << std::endl;
+                    continue;
+                }
+                AnimationStateMachine::ParameterSource source = AnimationStateMachine::ParameterSource::NONE;
+                if (parameterData.contains("source") && !parseParameterSource(parameterData["source"].get<std::string>(), source)) {
+                    std::cerr << "Warning: Unknown parameter source '" << parameterData["source"].get<std::string>() << "' in state machine '" << machineName << "'." << std::endl;
+                }
+                const float defaultValue = parameterData.contains("default") ? parameterData["default"].get<float>() : 0.0f;
+                if (machine->addParameter(parameterData["name"].get<std::string>(), source, defaultValue) < 0) {
+                    std::cerr << "Warning: State machine '" << machineName << "' has more than " << AnimationStateMachine::MAX_PARAMETERS << " parameters." << std::endl;
+                }
+            }
+        }
+
+        if (machineData.contains("events") && machineData["events"].is_array()) {
+            for (const auto& eventData : machineData["events"]) {
+                if (eventData.is_string() && machine->addEvent(eventData.get<std::string>()) < 0) {
+                    std::cerr << "Warning: State machine '" << machineName << "' has more than " << AnimationStateMachine::MAX_EVENTS << " events." << std::endl;
+                }
+            }
+        }
+
+        if (!machineData.contains("states") || !machineData["states"].is_array()) {
+            std::cerr << "Error: State machine '" << machineName << "' in " << jsonPath << " missing 'states' array." << std::endl;
+            continue;
+        }
+        for (const auto& stateData : machineData["states"]) {
+            if (!stateData.contains("name") || !stateData["name"].is_string()
+                || !stateData.contains("animation") || !stateData["animation"].is_string()) {
+                std::cerr << "Error: Malformed state in state machine '" << machineName << "'." << std::endl;
+                continue;
+            }
+            const AnimationHandle clip = getAnimationHandle(stateData["animation"].get<std::string>());
+            SDL_Texture* texture = nullptr;
+            if (table.isValid(clip)) {
+                Texture* clipTexture = textureManager_.getTexture(table.getTexturePath(clip));
+                texture = clipTexture ? clipTexture->sdlTexture_ : nullptr;
+            }
+            machine->addState(stateData["name"].get<std::string>(), clip, texture);
+        }
+        if (machine->getStateCount() == 0) {
+            std::cerr << "Error: State machine '" << machineName << "' has no valid states." << std::endl;
+            continue;
+        }
+
+        if (machineData.contains("initialState") && machineData["initialState"].is_string()) {
+            const int initialState = machine->findState(machineData["initialState"].get<std::string>());
+            if (initialState >= 0) {
+                machine->setInitialState(static_cast<uint16_t>(initialState));
+            } else {
+                std::cerr << "Warning: Unknown initial state in state machine '" << machineName << "'." << std::endl;
+            }
+        }
+
+        if (machineData.contains("transitions") && machineData["transitions"].is_array()) {
+            for (const auto& transitionData : machineData["transitions"]) {
+                if (!transitionData.is_object()
+                    || !transitionData.contains("from") || !transitionData["from"].is_string()
+                    || !transitionData.contains("to") || !transitionData["to"].is_string()
+                    || (transitionData.contains("minTime") && !transitionData["minTime"].is_number())) {
+                    std::cerr << "Error: Malformed transition in state machine '" << machineName << "'." << std::endl;
+                    continue;
+                }
+                const std::string from = transitionData["from"].get<std::string>();
+                const int fromState = from == "*" ? AnimationStateMachine::ANY_STATE : machine->findState(from);
+                const int toState = machine->findState(transitionData["to"].get<std::string>());
+                if (fromState < 0 || toState < 0) {
+                    std::cerr << "Error: Transition with unknown state in state machine '" << machineName << "'." << std::endl;
+                    continue;
+                }
+
+                AnimationStateMachine::Transition transition;
+                transition.target = static_cast<uint16_t>(toState);
+                transition.minStateTime = transitionData.contains("minTime") ? transitionData["minTime"].get<float>() : 0.0f;
+
+                if (transitionData.contains("parameter")) {
+                    if (!transitionData["parameter"].is_string() || !transitionData.contains("op") || !transitionData["op"].is_string()
+                        || !transitionData.contains("value") || !transitionData["value"].is_number()) {
+                        std::cerr << "Error: Malformed parameter condition in state machine '" << machineName << "'." << std::endl;
+                        continue;
+                    }
+                    const int parameter = machine->findParameter(transitionData["parameter"].get<std::string>());
+                    if (parameter < 0 || !parseComparison(transitionData["op"].get<std::string>(), transition.comparison)) {
+                        std::cerr << "Error: Malformed parameter condition in state machine '" << machineName << "'." << std::endl;
+                        continue;
+                    }
+                    transition.type = AnimationStateMachine::ConditionType::PARAMETER;
+                    transition.index = static_cast<uint8_t>(parameter);
+                    transition.threshold = transitionData["value"].get<float>();
+                } else if (transitionData.contains("event")) {
+                    if (!transitionData["event"].is_string()) {
+                        std::cerr << "Error: Malformed event condition in state machine '" << machineName << "'." << std::endl;
+                        continue;
+                    }
+                    const int event = machine->findEvent(transitionData["event"].get<std::string>());
+                    if (event < 0) {
+                        std::cerr << "Error: Unknown event in state machine '" << machineName << "'." << std::endl;
+                        continue;
+                    }
+                    transition.type = AnimationStateMachine::ConditionType::EVENT;
+                    transition.index = static_cast<uint8_t>(event);
+                } else if (transitionData.contains("finished") && transitionData["finished"].is_boolean()
+                           && transitionData["finished"].get<bool>()) {
+                    transition.type = AnimationStateMachine::ConditionType::FINISHED;
+                } else {
+                    std::cerr << "Error: Transition without condition in state machine '" << machineName << "'." << std::endl;
+                    continue;
+                }
+                machine->addTransition(static_cast<uint16_t>(fromState), transition);
+            }
+        }
+
+        stateMachines_[machineName] = std::move(machine);
+    }
+    return true;
+}
+
+const AnimationStateMachine* AnimationManager::getStateMachine(const std::string& name) const {
+    auto it = stateMachines_.find(name);
+    if (it != stateMachines_.end()) {
+        return it->second.get();
+    }
+    std::cerr << "Warning: State machine '" << name << "' not found." << std::endl;
+    return nullptr;
+}
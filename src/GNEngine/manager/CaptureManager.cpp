@@ -0,0 +1,278 @@
+#include "GNEngine/manager/CaptureManager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <SDL3_image/SDL_image.h>
+
+CaptureManager::CaptureManager(size_t bufferCount, size_t workerCount, DropPolicy dropPolicy)
+    : dropPolicy_(dropPolicy), buffers_(std::max<size_t>(bufferCount, 1)) {
+    freeBuffers_.reserve(buffers_.size());
+    for (size_t i = buffers_.size(); i > 0; --i) {
+        freeBuffers_.push_back(i - 1);
+    }
+
+    workerCount = std::max<size_t>(workerCount, 1);
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        workers_.emplace_back(&CaptureManager::workerLoop, this);
+    }
+}
+
+CaptureManager::~CaptureManager() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isStopping_ = true;
+    }
+    frameAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void CaptureManager::requestScreenshot(const std::filesystem::path& path, Format format) {
+    screenshotRequests_.push_back({path, format});
+}
+
+bool CaptureManager::startRecording(const std::filesystem::path& directory, Format format, int frameInterval) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        SDL_Log("CaptureManager::startRecording - Failed to create %s: %s", directory.string().c_str(), error.message().c_str());
+        return false;
+    }
+
+    recordDirectory_ = directory;
+    recordFormat_ = format;
+    recordInterval_ = std::max(frameInterval, 1);
+    recordStartFrame_ = frameIndex_;
+    isRecording_ = true;
+    return true;
+}
+
+void CaptureManager::stopRecording() {
+    isRecording_ = false;
+}
+
+bool CaptureManager::advanceFrame() {
+    const uint64_t frame = frameIndex_++;
+    frameJobs_.clear();
+    frameJobs_.swap(screenshotRequests_);
+
+    if (isRecording_ && (frame - recordStartFrame_) % static_cast<uint64_t>(recordInterval_) == 0) {
+        char fileName[64];
+        SDL_snprintf(fileName, sizeof(fileName), "frame_%06llu.%s", static_cast<unsigned long long>(frame), getExtension(recordFormat_));
+        frameJobs_.push_back({recordDirectory_ / fileName, recordFormat_});
+    }
+    return !frameJobs_.empty();
+}
+
+void CaptureManager::captureRenderer(SDL_Renderer* renderer) {
+    if (frameJobs_.empty()) {
+        return;
+    }
+
+    const uint64_t start = SDL_GetTicksNS();
+    SDL_Surface* surface = SDL_RenderReadPixels(renderer, nullptr);
+    if (!surface) {
+        SDL_Log("CaptureManager::captureRenderer - Failed to read pixels: %s", SDL_GetError());
+        std::lock_guard<std::mutex> lock(mutex_);
+        requested_ += frameJobs_.size();
+        failed_ += frameJobs_.size();
+        frameJobs_.clear();
+        return;
+    }
+    enqueue(surface->pixels, surface->w, surface->h, surface->pitch, surface->format, start);
+    SDL_DestroySurface(surface);
+}
+
+void CaptureManager::capturePixels(const void* pixels, int width, int height, int pitch, SDL_PixelFormat format) {
+    if (frameJobs_.empty()) {
+        return;
+    }
+    enqueue(pixels, width, height, pitch, format, SDL_GetTicksNS());
+}
+
+size_t CaptureManager::acquireBuffer() {
+    if (!freeBuffers_.empty()) {
+        const size_t index = freeBuffers_.back();
+        freeBuffers_.pop_back();
+        return index;
+    }
+    if (dropPolicy_ == DropPolicy::DROP_OLDEST && !pendingBuffers_.empty()) {
+        const size_t index = pendingBuffers_.front();
+        pendingBuffers_.pop_front();
+        ++dropped_;
+        return index;
+    }
+    return SIZE_MAX;
+}
+
+/* 프레임을 이번 프레임의 작업 수만큼 버퍼에 복사해 큐에 넣음. 복사는 잠금 밖에서 함. */
+void CaptureManager::enqueue(const void* pixels, int width, int height, int pitch, SDL_PixelFormat format, uint64_t requestTicksNS) {
+    const size_t rowBytes = static_cast<size_t>(width) * SDL_BYTESPERPIXEL(format);
+
+    for (Job& job : frameJobs_) {
+        size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++requested_;
+            if (firstRequestTicksNS_ == 0) {
+                firstRequestTicksNS_ = requestTicksNS;
+            }
+            index = acquireBuffer();
+            if (index == SIZE_MAX) {
+                ++dropped_;
+                continue;
+            }
+        }
+
+        FrameBuffer& buffer = buffers_[index];
+        buffer.pixels.resize(rowBytes * height);
+        for (int row = 0; row < height; ++row) {
+            std::memcpy(buffer.pixels.data() + rowBytes * row, static_cast<const uint8_t*>(pixels) + static_cast<size_t>(pitch) * row, rowBytes);
+        }
+        buffer.width = width;
+        buffer.height = height;
+        buffer.pitch = static_cast<int>(rowBytes);
+        buffer.pixelFormat = format;
+        buffer.job = std::move(job);
+        buffer.requestTicksNS = requestTicksNS;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pendingBuffers_.push_back(index);
+        }
+        frameAvailable_.notify_one();
+    }
+    frameJobs_.clear();
+
+    const uint64_t elapsed = SDL_GetTicksNS() - requestTicksNS;
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++readbackCount_;
+    readbackNs_ += elapsed;
+    maxReadbackNs_ = std::max(maxReadbackNs_, elapsed);
+}
+
+void CaptureManager::workerLoop() {
+    while (true) {
+        size_t index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            frameAvailable_.wait(lock, [this]() { return isStopping_ || !pendingBuffers_.empty(); });
+            if (pendingBuffers_.empty()) {
+                return;
+            }
+            index = pendingBuffers_.front();
+            pendingBuffers_.pop_front();
+            ++encodingCount_;
+        }
+
+        FrameBuffer& buffer = buffers_[index];
+        const bool isWritten = encode(buffer);
+        const uint64_t now = SDL_GetTicksNS();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (isWritten) {
+                ++written_;
+                writtenBytes_ += buffer.pixels.size();
+                latencyNs_ += now - buffer.requestTicksNS;
+                maxLatencyNs_ = std::max(maxLatencyNs_, now - buffer.requestTicksNS);
+                lastWrittenTicksNS_ = now;
+            } else {
+                ++failed_;
+            }
+            freeBuffers_.push_back(index);
+            --encodingCount_;
+        }
+        idle_.notify_all();
+    }
+}
+
+bool CaptureManager::encode(FrameBuffer& buffer) {
+    const std::string path = buffer.job.path.string();
+
+    if (buffer.job.format == Format::RAW) {
+        std::vector<uint8_t> converted;
+        const uint8_t* data = buffer.pixels.data();
+        if (buffer.pixelFormat != SDL_PIXELFORMAT_ARGB8888) {
+            converted.resize(static_cast<size_t>(buffer.width) * buffer.height * sizeof(uint32_t));
+            if (!SDL_ConvertPixels(buffer.width, buffer.height, buffer.pixelFormat, buffer.pixels.data(), buffer.pitch,
+                                   SDL_PIXELFORMAT_ARGB8888, converted.data(), buffer.width * static_cast<int>(sizeof(uint32_t)))) {
+                SDL_Log("CaptureManager::encode - Failed to convert %s: %s", path.c_str(), SDL_GetError());
+                return false;
+            }
+            data = converted.data();
+        }
+
+        std::ofstream file(buffer.job.path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(buffer.width) * buffer.height * sizeof(uint32_t));
+        if (!file) {
+            SDL_Log("CaptureManager::encode - Failed to write %s", path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    SDL_Surface* surface = SDL_CreateSurfaceFrom(buffer.width, buffer.height, buffer.pixelFormat, buffer.pixels.data(), buffer.pitch);
+    if (!surface) {
+        SDL_Log("CaptureManager::encode - Failed to wrap frame %s: %s", path.c_str(), SDL_GetError());
+        return false;
+    }
+    const bool isSaved = buffer.job.format == Format::PNG ? IMG_SavePNG(surface, path.c_str()) : SDL_SaveBMP(surface, path.c_str());
+    if (!isSaved) {
+        SDL_Log("CaptureManager::encode - Failed to save %s: %s", path.c_str(), SDL_GetError());
+    }
+    SDL_DestroySurface(surface);
+    return isSaved;
+}
+
+void CaptureManager::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return pendingBuffers_.empty() && encodingCount_ == 0; });
+}
+
+CaptureManager::Stats CaptureManager::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats stats;
+    stats.requested = requested_;
+    stats.written = written_;
+    stats.dropped = dropped_;
+    stats.failed = failed_;
+
+    if (readbackCount_ > 0) {
+        stats.averageReadbackMs = readbackNs_ / 1.0e6 / static_cast<double>(readbackCount_);
+    }
+    stats.maxReadbackMs = maxReadbackNs_ / 1.0e6;
+    if (written_ > 0) {
+        stats.averageLatencyMs = latencyNs_ / 1.0e6 / static_cast<double>(written_);
+    }
+    stats.maxLatencyMs = maxLatencyNs_ / 1.0e6;
+
+    if (lastWrittenTicksNS_ > firstRequestTicksNS_) {
+        const double seconds = (lastWrittenTicksNS_ - firstRequestTicksNS_) / 1.0e9;
+        stats.framesPerSecond = written_ / seconds;
+        stats.megabytesPerSecond = writtenBytes_ / (1024.0 * 1024.0) / seconds;
+    }
+    return stats;
+}
+
+void CaptureManager::logStats() const {
+    const Stats stats = getStats();
+    SDL_Log("CaptureManager - requested %llu, written %llu, dropped %llu, failed %llu | readback avg %.3f ms (max %.3f) | "
+            "latency avg %.2f ms (max %.2f) | %.1f frames/s, %.1f MB/s",
+            static_cast<unsigned long long>(stats.requested), static_cast<unsigned long long>(stats.written),
+            static_cast<unsigned long long>(stats.dropped), static_cast<unsigned long long>(stats.failed),
+            stats.averageReadbackMs, stats.maxReadbackMs, stats.averageLatencyMs, stats.maxLatencyMs,
+            stats.framesPerSecond, stats.megabytesPerSecond);
+}
+
+const char* CaptureManager::getExtension(Format format) {
+    switch (format) {
+        case Format::PNG: return "png";
+        case Format::BMP: return "bmp";
+        case Format::RAW: return "raw";
+    }
+    return "bin";
+}
@@ -0,0 +1,128 @@
+#include "GNEngine/manager/JobManager.h"
+
+#include <algorithm>
+#include <memory>
+#include <SDL3/SDL_log.h>
+
+JobManager::JobManager(size_t threadCount) {
+    if (threadCount == 0) {
+        const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+        threadCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    workers_.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        workers_.emplace_back(&JobManager::workerLoop, this);
+    }
+}
+
+/* 큐에 남은 작업을 모두 실행한 뒤 워커를 종료함. */
+JobManager::~JobManager() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        isStopping_ = true;
+    }
+    jobAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void JobManager::submit(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(std::move(job));
+    }
+    jobAvailable_.notify_one();
+}
+
+void JobManager::parallelFor(size_t count, const std::function<void(size_t)>& job) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || workers_.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    // 도우미는 호출자가 돌아간 뒤에 시작될 수도 있으므로 공유 상태는 힙에 두고 도우미가 함께 소유함.
+    // job은 호출자 스택에 있으므로 isFinished 전에 시작한 도우미만 쓰며, 호출자는 그 도우미들만 기다림
+    struct SharedState {
+        std::atomic<size_t> nextIndex{0};
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t activeHelpers = 0;
+        bool isFinished = false;
+    };
+    auto state = std::make_shared<SharedState>();
+
+    auto runRange = [count](SharedState& shared, const std::function<void(size_t)>& work) {
+        for (size_t i = shared.nextIndex.fetch_add(1); i < count; i = shared.nextIndex.fetch_add(1)) {
+            work(i);
+        }
+    };
+
+    // 호출 스레드도 일하므로 도우미는 최대 count - 1개면 충분함.
+    // submit으로 쌓인 비동기 작업(사운드 디코딩 등) 뒤에서 기다리지 않도록 큐 앞에 넣음
+    const size_t helperCount = std::min(workers_.size(), count - 1);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t h = 0; h < helperCount; ++h) {
+            jobs_.push_front([state, runRange, &job]() {
+                {
+                    std::lock_guard<std::mutex> stateLock(state->mutex);
+                    if (state->isFinished) {
+                        return; // 호출자가 이미 끝남. job은 더 이상 유효하지 않음
+                    }
+                    ++state->activeHelpers;
+                }
+                runRange(*state, job);
+                std::lock_guard<std::mutex> stateLock(state->mutex);
+                if (--state->activeHelpers == 0) {
+                    state->done.notify_one();
+                }
+            });
+        }
+    }
+    jobAvailable_.notify_all();
+
+    runRange(*state, job);
+
+    // 남은 인덱스는 없으므로 아직 시작하지 않은 도우미는 그냥 빠져나가게 하고, 실행 중인 도우미만 기다림
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->isFinished = true;
+    state->done.wait(lock, [&state]() { return state->activeHelpers == 0; });
+}
+
+void JobManager::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() { return jobs_.empty() && activeJobs_ == 0; });
+}
+
+void JobManager::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            jobAvailable_.wait(lock, [this]() { return isStopping_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return; // isStopping_이고 남은 작업 없음
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+            ++activeJobs_;
+        }
+
+        job();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --activeJobs_;
+            if (jobs_.empty() && activeJobs_ == 0) {
+                idle_.notify_all();
+            }
+        }
+    }
+}
@@ -1,27 +1,42 @@
 ﻿#include "GNEngine/manager/RenderManager.h"
+#include "GNEngine/core/SoftwareRasterizer.h"
+#include "GNEngine/manager/CaptureManager.h"
+#include "GNEngine/manager/TextureManager.h"
+
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <SDL3/SDL_render.h>
 
 /* 
  * @brief RenderManager의 생성자.
  * @param renderer SDL_CreateRenderer로 초기화가 끝난 SDL_Renderer 객체
- * @param window SDL_CreateWindow로 초기화가 끝난 SDL_Window 객체
+ * @param window SDL_CreateWindow로 초기화가 끝난 SDL_Window 객체. 오프스크린 렌더링(벤치마크 등)에서는 nullptr 가능.
  * @return 초기화 성공 여부 (true: 성공, false: 실패)
  */
 RenderManager::RenderManager(SDL_Renderer* renderer, SDL_Window* window)
-    : renderer_(renderer), window_(window) {
-    if (!renderer_ || !window_) {
-        SDL_Log("RenderManager::init - Renderer or Window is null: %s", SDL_GetError());
+    : renderer_(renderer), window_(window), spriteBatch_(renderer) {
+    if (!renderer_) {
+        SDL_Log("RenderManager::init - Renderer is null: %s", SDL_GetError());
     }
 }
 
 RenderManager::~RenderManager() {
     // Renderer와 Window는 Application 클래스에서 소유하고 파괴하므로, 여기서는 파괴하지 않음.
+    if (rasterTexture_) {
+        SDL_DestroyTexture(rasterTexture_);
+    }
     std::cerr << "RenderManager " << this << " is successfully destroyed" << std::endl;
 }
 
-/* 배경 색 설정 및 화면 비우기. */
+/*
+ * 배경 색 설정 및 화면 비우기. RenderSystem이 프레임을 새로 그릴 때만 호출함.
+ * 래스터 결과를 렌더러에 올리는 경우 래스터 프레임은 투명하게 비우고 배경색은 SDL 출력에만 칠함.
+ */
 void RenderManager::clear() {
+    if (rasterizer_) {
+        rasterizer_->beginFrame(isRasterPresented_ ? SDL_Color{0, 0, 0, 0} : backgroundColor);
+    }
     if (renderer_) {
         SDL_SetRenderDrawColor(renderer_, backgroundColor.r, backgroundColor.g, backgroundColor.b, backgroundColor.a); /* 배경색 설정 */
         SDL_RenderClear(renderer_);
@@ -30,11 +45,73 @@ void RenderManager::clear() {
 
 /* 화면에 렌더링된 내용을 실제로 표시. */
 void RenderManager::present() {
+    wasLastPresentSkipped_ = isPresentSkipped_;
+    if (isPresentSkipped_) {
+        isPresentSkipped_ = false;
+        return;
+    }
+    spriteBatch_.flush();
+    // 이번 프레임의 드로우가 모두 렌더러에 넘어갔으므로 내보낸 축소본을 파괴해도 됨
+    if (textureManager_) {
+        textureManager_->releaseRetiredVariants();
+    }
+    const bool isCaptureDue = captureManager_ && captureManager_->advanceFrame();
+    if (rasterizer_) {
+        rasterizer_->endFrame();
+        if (!isRasterPresented_) {
+            if (isCaptureDue) {
+                captureManager_->capturePixels(rasterizer_->getPixels(), rasterizer_->getWidth(), rasterizer_->getHeight(),
+                                               rasterizer_->getPitch(), SDL_PIXELFORMAT_ARGB8888);
+            }
+            return;
+        }
+        // 래스터 프레임은 배경이 투명하므로 SDL 출력과 합친 뒤에 캡처함
+        presentRasterFrame();
+    }
+    if (isCaptureDue && renderer_) {
+        captureManager_->captureRenderer(renderer_);
+    }
     if (renderer_) {
         SDL_RenderPresent(renderer_);
     }
 }
 
+void RenderManager::setRasterizer(SoftwareRasterizer* rasterizer, bool isPresentedToRenderer) {
+    spriteBatch_.setRasterizer(rasterizer);
+    rasterizer_ = rasterizer;
+    isRasterPresented_ = isPresentedToRenderer;
+}
+
+/* 래스터 결과를 스트리밍 텍스처에 올려 렌더 출력 전체에 그림. 크기가 바뀌면 텍스처를 다시 만듦. */
+void RenderManager::presentRasterFrame() {
+    if (!renderer_) {
+        return;
+    }
+
+    float textureWidth = 0.0f, textureHeight = 0.0f;
+    if (rasterTexture_) {
+        SDL_GetTextureSize(rasterTexture_, &textureWidth, &textureHeight);
+    }
+    if (!rasterTexture_ || static_cast<int>(textureWidth) != rasterizer_->getWidth() || static_cast<int>(textureHeight) != rasterizer_->getHeight()) {
+        if (rasterTexture_) {
+            SDL_DestroyTexture(rasterTexture_);
+        }
+        rasterTexture_ = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                           rasterizer_->getWidth(), rasterizer_->getHeight());
+        if (!rasterTexture_) {
+            SDL_Log("RenderManager::presentRasterFrame - Failed to create raster texture: %s", SDL_GetError());
+            return;
+        }
+        SDL_SetTextureBlendMode(rasterTexture_, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    }
+
+    if (!SDL_UpdateTexture(rasterTexture_, nullptr, rasterizer_->getPixels(), rasterizer_->getPitch())) {
+        SDL_Log("RenderManager::presentRasterFrame - Failed to upload raster frame: %s", SDL_GetError());
+        return;
+    }
+    SDL_RenderTexture(renderer_, rasterTexture_, nullptr, nullptr);
+}
+
 /* 텍스처 렌더링. 
  * @brief 텍스처를 지정된 위치에 렌더링함.
  * @param texture 렌더링할 텍스처 객체
@@ -85,17 +162,291 @@ void RenderManager::renderTexture(SDL_Texture* texture, float x, float y, const
         dstRect.h = h * zoomLevel_;
     }
 
-    // 카메라 위치를 적용하여 화면 좌표 계산
-    float screenX = (x - cameraX_) * zoomLevel_ + (getWindowWidth() / 2.0f);
-    float screenY = (y - cameraY_) * zoomLevel_ + (getWindowHeight() / 2.0f);
+    // 카메라 위치를 적용하여 화면 좌표 계산. 오프스크린 패스 중에는 패스 원점을 기준으로 계산함.
+    float screenX, screenY;
+    worldToScreen(x, y, screenX, screenY);
 
     dstRect.x = screenX - dstRect.w / 2.0f; // Adjust x to center
     dstRect.y = screenY - dstRect.h / 2.0f; // Adjust y to center
 
-    /* 텍스처 렌더링 */
-    if (!SDL_RenderTextureRotated(renderer_, texture, srcRect ? &srcFRect : nullptr, &dstRect, 0.0, nullptr, flip)) {
-        SDL_Log("RenderManager::renderTexture - Failed to render texture: %s", SDL_GetError());
+    /* 텍스처를 스프라이트 배치에 추가. 축소해서 그리면 가장 가까운 축소본으로 바꿈 */
+    bool hasSrcRect = srcRect != nullptr;
+    texture = selectScaledVariant(texture, srcFRect, hasSrcRect, dstRect);
+    drawSprite(texture, hasSrcRect ? &srcFRect : nullptr, dstRect, {1.0f, 1.0f, 1.0f, 1.0f}, flip);
+}
+
+void RenderManager::renderTextureRotated(SDL_Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h,
+                                         float sinAngle, float cosAngle, float pivotX, float pivotY, SDL_FlipMode flip) {
+    if (!renderer_) {
+        SDL_Log("RenderManager::renderTextureRotated - Renderer is null. : %s", SDL_GetError());
+        return;
+    }
+    if (!texture) {
+        SDL_Log("RenderManager::renderTextureRotated - SDL_Texture* is null. : %s", SDL_GetError());
+        return;
+    }
+
+    SDL_FRect srcFRect;
+    if (srcRect) {
+        srcFRect = {static_cast<float>(srcRect->x), static_cast<float>(srcRect->y), static_cast<float>(srcRect->w), static_cast<float>(srcRect->h)};
+    }
+
+    if (w == 0 || h == 0) {
+        if (srcRect) {
+            w = srcFRect.w;
+            h = srcFRect.h;
+        } else {
+            SDL_GetTextureSize(texture, &w, &h);
+        }
     }
+
+    float screenX, screenY;
+    worldToScreen(x, y, screenX, screenY);
+
+    SDL_FRect dstRect;
+    dstRect.w = w * zoomLevel_;
+    dstRect.h = h * zoomLevel_;
+    dstRect.x = screenX - dstRect.w * pivotX;
+    dstRect.y = screenY - dstRect.h * pivotY;
+
+    bool hasSrcRect = srcRect != nullptr;
+    texture = selectScaledVariant(texture, srcFRect, hasSrcRect, dstRect);
+    drawSpriteRotated(texture, hasSrcRect ? &srcFRect : nullptr, dstRect, sinAngle, cosAngle, screenX, screenY, {1.0f, 1.0f, 1.0f, 1.0f}, flip);
+}
+
+/*
+ * @brief 소스 영역이 dstRect보다 절반 이하로 줄어 그려지면 TextureManager의 축소본과 그에 맞춘 소스 영역을 돌려줌.
+ *        축소본이 없거나 아직 만들어지는 중이면 texture를 그대로 돌려줌.
+ */
+SDL_Texture* RenderManager::selectScaledVariant(SDL_Texture* texture, SDL_FRect& srcFRect, bool& hasSrcRect, const SDL_FRect& dstRect) {
+    if (!textureManager_ || rasterizer_ || !textureManager_->isScaledVariantEnabled()) {
+        return texture;
+    }
+    if (!hasSrcRect) {
+        srcFRect.x = srcFRect.y = 0.0f;
+        SDL_GetTextureSize(texture, &srcFRect.w, &srcFRect.h);
+    }
+    if (srcFRect.w <= 0.0f || srcFRect.h <= 0.0f) {
+        return texture;
+    }
+
+    const float scale = std::max(std::fabs(dstRect.w) / srcFRect.w, std::fabs(dstRect.h) / srcFRect.h);
+    float scaleX = 1.0f, scaleY = 1.0f;
+    SDL_Texture* variant = textureManager_->getScaledVariant(texture, scale, scaleX, scaleY);
+    if (variant == texture) {
+        return texture;
+    }
+    srcFRect = {srcFRect.x * scaleX, srcFRect.y * scaleY, srcFRect.w * scaleX, srcFRect.h * scaleY};
+    hasSrcRect = true;
+    return variant;
+}
+
+void RenderManager::worldToScreen(float worldX, float worldY, float& outScreenX, float& outScreenY) const {
+    if (passTarget_) {
+        outScreenX = (worldX - passOriginX_) * zoomLevel_;
+        outScreenY = (worldY - passOriginY_) * zoomLevel_;
+    } else {
+        outScreenX = (worldX - cameraX_) * zoomLevel_ + (getViewWidth() / 2.0f);
+        outScreenY = (worldY - cameraY_) * zoomLevel_ + (getViewHeight() / 2.0f);
+    }
+}
+
+/*
+ * @brief 이후의 드로우를 viewport 영역으로 제한하고 카메라 상태를 바꿈.
+ *        SDL 뷰포트를 쓰므로 드로우 좌표는 viewport 좌상단 기준이며, 뷰는 중첩되지 않음.
+ */
+void RenderManager::beginCameraView(const SDL_Rect& viewport, float cameraX, float cameraY, float zoom) {
+    if (!renderer_) {
+        return;
+    }
+    if (isInCameraView_) {
+        endCameraView();
+    }
+
+    if (recordList_) {
+        recordList_->beginView(viewport, cameraX, cameraY, zoom);
+    } else {
+        spriteBatch_.flush();
+        SDL_GetRenderViewport(renderer_, &prevViewport_);
+        SDL_SetRenderViewport(renderer_, &viewport);
+        if (rasterizer_) {
+            rasterizer_->setViewport(&viewport);
+        }
+    }
+
+    prevCameraX_ = cameraX_;
+    prevCameraY_ = cameraY_;
+    prevZoomLevel_ = zoomLevel_;
+    cameraX_ = cameraX;
+    cameraY_ = cameraY;
+    zoomLevel_ = zoom;
+
+    viewWidth_ = viewport.w;
+    viewHeight_ = viewport.h;
+    isInCameraView_ = true;
+}
+
+void RenderManager::endCameraView() {
+    if (!isInCameraView_) {
+        return;
+    }
+    if (recordList_) {
+        recordList_->endView();
+    } else {
+        spriteBatch_.flush();
+        SDL_SetRenderViewport(renderer_, &prevViewport_);
+        if (rasterizer_) {
+            rasterizer_->setViewport(nullptr);
+        }
+    }
+
+    cameraX_ = prevCameraX_;
+    cameraY_ = prevCameraY_;
+    zoomLevel_ = prevZoomLevel_;
+    isInCameraView_ = false;
+}
+
+/*
+ * @brief 월드 공간 드로우를 target 텍스처로 보냄. 정적 레이어 캐시 등에서 사용함.
+ *        패스는 중첩되지 않으며, 반드시 endOffscreenPass로 닫아야 함.
+ */
+bool RenderManager::beginOffscreenPass(SDL_Texture* target, float originX, float originY) {
+    if (!renderer_ || !target) {
+        SDL_Log("RenderManager::beginOffscreenPass - Renderer or target is null.");
+        return false;
+    }
+    if (passTarget_) {
+        SDL_Log("RenderManager::beginOffscreenPass - Offscreen pass is already active.");
+        return false;
+    }
+    if (rasterizer_) {
+        return false; // 래스터라이저는 렌더 타겟 텍스처에 그릴 수 없음
+    }
+
+    spriteBatch_.flush();
+    passPrevTarget_ = SDL_GetRenderTarget(renderer_);
+    if (!SDL_SetRenderTarget(renderer_, target)) {
+        SDL_Log("RenderManager::beginOffscreenPass - Failed to set render target: %s", SDL_GetError());
+        return false;
+    }
+
+    passTarget_ = target;
+    passOriginX_ = originX;
+    passOriginY_ = originY;
+    passRecordList_ = recordList_;
+    recordList_ = nullptr;
+    return true;
+}
+
+void RenderManager::endOffscreenPass() {
+    if (!passTarget_) {
+        return;
+    }
+    spriteBatch_.flush();
+    if (!SDL_SetRenderTarget(renderer_, passPrevTarget_)) {
+        SDL_Log("RenderManager::endOffscreenPass - Failed to restore render target: %s", SDL_GetError());
+    }
+    passTarget_ = nullptr;
+    passPrevTarget_ = nullptr;
+    recordList_ = passRecordList_;
+    passRecordList_ = nullptr;
+}
+
+void RenderManager::fillRect(const SDL_FRect& rect, SDL_FColor color) {
+    if (recordList_) {
+        recordList_->fillRect(rect, color);
+        return;
+    }
+    // 텍스처 없는 지오메트리는 렌더러의 드로우 블렌드 모드를 따름. setDrawBlendMode가 배치를 끊어 줌
+    spriteBatch_.draw(nullptr, nullptr, rect, color);
+}
+
+void RenderManager::drawQuads(SDL_Texture* texture, const SDL_Vertex* vertices, size_t quadCount, SDL_BlendMode blendMode) {
+    if (recordList_) {
+        recordList_->drawQuads(texture, vertices, quadCount, blendMode);
+        return;
+    }
+    if (blendMode == SDL_BLENDMODE_INVALID || (!texture && !renderer_)) {
+        spriteBatch_.drawQuads(texture, vertices, quadCount);
+        return;
+    }
+
+    // 텍스처와 렌더러는 다른 드로우와 공유하므로 바꾼 블렌드 모드는 그린 뒤 되돌림.
+    // 블렌드 모드는 배치를 그리는 시점에 읽히므로 앞뒤로 배치를 비움
+    spriteBatch_.flush();
+    SDL_BlendMode previousBlendMode = SDL_BLENDMODE_BLEND;
+    if (texture) {
+        SDL_GetTextureBlendMode(texture, &previousBlendMode);
+        SDL_SetTextureBlendMode(texture, blendMode);
+    } else {
+        SDL_GetRenderDrawBlendMode(renderer_, &previousBlendMode);
+        SDL_SetRenderDrawBlendMode(renderer_, blendMode);
+    }
+    spriteBatch_.drawQuads(texture, vertices, quadCount);
+    spriteBatch_.flush();
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, previousBlendMode);
+    } else {
+        SDL_SetRenderDrawBlendMode(renderer_, previousBlendMode);
+    }
+}
+
+void RenderManager::setDrawBlendMode(SDL_BlendMode blendMode) {
+    if (recordList_) {
+        recordList_->setBlendMode(blendMode);
+        return;
+    }
+    if (renderer_) {
+        spriteBatch_.flush();
+        SDL_SetRenderDrawBlendMode(renderer_, blendMode);
+    }
+}
+
+/*
+ * @brief 기록된 명령을 순서대로 실행함. 실행 중에는 기록하지 않으므로 기록 중에 호출하면 기록을 잠시 멈춤.
+ *        카메라 뷰 명령은 beginCameraView/endCameraView로 실행되어, CUSTOM 명령도 기록 당시의 카메라 상태를 봄.
+ */
+void RenderManager::execute(const RenderCommandList& list) {
+    RenderCommandList* const savedRecordList = recordList_;
+    recordList_ = nullptr;
+
+    const auto& callbacks = list.getCallbacks();
+    for (const RenderCommandList::Command& command : list.getCommands()) {
+        switch (command.type) {
+        case RenderCommandList::Type::SPRITE:
+            spriteBatch_.draw(command.texture, command.hasSrcRect ? &command.srcRect : nullptr, command.dstRect, command.color, command.flip);
+            break;
+        case RenderCommandList::Type::SPRITE_ROTATED:
+            spriteBatch_.drawRotated(command.texture, command.hasSrcRect ? &command.srcRect : nullptr, command.dstRect,
+                                     command.sinAngle, command.cosAngle, command.originX, command.originY, command.color, command.flip);
+            break;
+        case RenderCommandList::Type::FILL_RECT:
+            fillRect(command.dstRect, command.color);
+            break;
+        case RenderCommandList::Type::SET_BLEND_MODE:
+            spriteBatch_.flush();
+            setDrawBlendMode(command.blendMode);
+            break;
+        case RenderCommandList::Type::BEGIN_VIEW:
+            beginCameraView(command.viewport, command.originX, command.originY, command.zoom);
+            break;
+        case RenderCommandList::Type::END_VIEW:
+            endCameraView();
+            break;
+        case RenderCommandList::Type::CUSTOM:
+            spriteBatch_.flush();
+            if (command.callbackIndex < callbacks.size() && callbacks[command.callbackIndex]) {
+                callbacks[command.callbackIndex]();
+            }
+            break;
+        case RenderCommandList::Type::GEOMETRY:
+            drawQuads(command.texture, list.getVertices().data() + command.vertexOffset, command.quadCount, command.blendMode);
+            break;
+        }
+    }
+    spriteBatch_.flush();
+
+    recordList_ = savedRecordList;
 }
 
 void RenderManager::renderUITexture(SDL_Texture* texture, float x, float y, const SDL_Rect* srcRect, float w, float h, SDL_FlipMode flip) {
@@ -137,7 +488,5 @@ void RenderManager::renderUITexture(SDL_Texture* texture, float x, float y, cons
     dstRect.x = x;
     dstRect.y = y;
 
-    if (!SDL_RenderTextureRotated(renderer_, texture, srcRect ? &srcFRect : nullptr, &dstRect, 0.0, nullptr, flip)) {
-        SDL_Log("RenderManager::renderUITexture - Failed to render texture: %s", SDL_GetError());
-    }
+    drawSprite(texture, srcRect ? &srcFRect : nullptr, dstRect, {1.0f, 1.0f, 1.0f, 1.0f}, flip);
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <filesystem>
 
+#include "GNEngine/manager/JobManager.h"
+#include "GNEngine/core/PcmConvert.h"
+
 #include <AL/alc.h>
 #include <AL/alext.h> 
 
@@ -65,19 +68,52 @@ bool SoundManager::initAL() {
         alSourcef(sourceIdsRight_[i], AL_ROLLOFF_FACTOR, 1.0f);
     }
 
-    std::cout << "OpenAL initialized with " << MAX_VOICES << " voices." << std::endl;
+    // 0번 보이스부터 꺼내 쓰도록 거꾸로 쌓음
+    freeVoices_.clear();
+    for (size_t i = MAX_VOICES; i-- > 0;) {
+        freeVoices_.push_back(static_cast<uint32_t>(i));
+    }
+    activeVoices_.clear();
+    activeVoices_.reserve(MAX_VOICES);
+    activeSlots_.assign(MAX_VOICES, 0);
+    voiceSequences_.assign(MAX_VOICES, 0);
+    stealHeap_.clear();
+    stealHeap_.reserve(MAX_VOICES * 2);
+
+    isUsingSourceEvents_ = enableSourceEvents();
+
+    std::cout << "OpenAL initialized with " << MAX_VOICES << " voices"
+              << (isUsingSourceEvents_ ? " (AL_SOFT_events)." : ".") << std::endl;
     return true;
 }
 
 void SoundManager::quitAL() {
+    // 스트림이 SoundManager보다 오래 살아도 사라진 컨텍스트에 AL을 호출하지 않도록 먼저 정리함
+    stopStreamThread();
+    for (auto& weakStream : streams_) {
+        if (auto stream = weakStream.lock()) {
+            stream->releaseAL();
+        }
+    }
+    streams_.clear();
+
+    // 진행 중인 디코딩 작업이 this를 잡고 있으므로 끝날 때까지 기다린 뒤 남은 결과를 버림
+    {
+        std::unique_lock<std::mutex> lock(pendingMutex_);
+        pendingIdle_.wait(lock, [this] { return pendingDecodeCount_ == 0; });
+        decodedSounds_.clear();
+    }
+
     if (context_) {
         stopAllSounds();
+        disableSourceEvents();
         alDeleteSources(MAX_VOICES, sourceIdsLeft_.data());
         alDeleteSources(MAX_VOICES, sourceIdsRight_.data());
         sourceIdsLeft_.clear();
         sourceIdsRight_.clear();
         sourceIdToIndexMap_.clear();
         soundCache_.clear();
+        residentBytes_ = 0;
         
         alcMakeContextCurrent(NULL);
         alcDestroyContext(context_);
@@ -103,39 +139,282 @@ void SoundManager::checkAlErrors(const std::string& filename, int line) {
 */
 std::shared_ptr<Sound> SoundManager::getSound(const std::filesystem::path& filePath) {
     if (auto it = soundCache_.find(filePath); it != soundCache_.end()) {
-        return it->second;
+        std::shared_ptr<Sound> sound = it->second;
+        if (sound->getState() == Sound::State::EVICTED) {
+            ++cacheMisses_;
+            reloadSound(sound, nullptr);
+        } else {
+            ++cacheHits_;
+        }
+        return sound;
     }
 
-    ALuint monoBuffer = 0, stereoBufferRight = 0;
-    bool isStereo = false, loaded = false;
-    std::string ext = filePath.extension().string();
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-
-    if (ext == ".wav") { loaded = loadWav(filePath, monoBuffer, stereoBufferRight, isStereo); }
-    else if (ext == ".mp3") { loaded = loadMp3(filePath, monoBuffer, stereoBufferRight, isStereo); }
-    else if (ext == ".ogg") { loaded = loadOgg(filePath, monoBuffer, stereoBufferRight, isStereo); }
-    else if (ext == ".flac") { loaded = loadFlac(filePath, monoBuffer, stereoBufferRight, isStereo); }
-    else { std::cerr << "Unsupported format: " << ext << std::endl; 
-        return nullptr; 
+    if (!isSupportedFormat(filePath)) {
+        std::cerr << "Unsupported format: " << filePath.extension().string() << std::endl;
+        return nullptr;
     }
 
-    if (loaded) {
-        auto sound = std::make_shared<Sound>(monoBuffer, stereoBufferRight, isStereo);
-        soundCache_[filePath] = sound;
-        return sound; /* Success */
+    ++cacheMisses_;
+    // PCM은 스레드별 스크래치에 디코딩해 버퍼에 올리고, 다음 디코딩이 그 용량을 다시 씀. 캐시 예산에는 OpenAL 버퍼 크기만 잡힘
+    DecodedSound& pcm = getDecodeScratch();
+    ALuint monoBuffer = 0, stereoBufferRight = 0;
+    if (decodeSound(filePath, pcm)) {
+        evictSounds(getByteSize(pcm));
+        if (uploadSound(pcm, monoBuffer, stereoBufferRight)) {
+            auto sound = std::make_shared<Sound>(monoBuffer, stereoBufferRight, pcm.isStereo);
+            markResident(*sound, filePath, getByteSize(pcm));
+            soundCache_[filePath] = sound;
+            return sound; /* Success */
+        }
     }
     /* failure */
-    if (monoBuffer != 0) alDeleteBuffers(1, &monoBuffer);
-    if (stereoBufferRight != 0) alDeleteBuffers(1, &stereoBufferRight);
+    std::cerr << "Failed to load sound: " << filePath.string() << std::endl;
     return nullptr;
 }
 
+std::shared_ptr<Sound> SoundManager::loadSoundAsync(const std::filesystem::path& filePath, JobManager& jobManager) {
+    if (auto it = soundCache_.find(filePath); it != soundCache_.end()) {
+        std::shared_ptr<Sound> sound = it->second;
+        if (sound->getState() == Sound::State::EVICTED) {
+            ++cacheMisses_;
+            reloadSound(sound, &jobManager);
+        } else {
+            ++cacheHits_;
+        }
+        return sound;
+    }
+    if (!isSupportedFormat(filePath)) {
+        std::cerr << "Unsupported format: " << filePath.extension().string() << std::endl;
+        return nullptr;
+    }
+
+    ++cacheMisses_;
+    auto sound = std::make_shared<Sound>();
+    sound->path_ = filePath;
+    soundCache_[filePath] = sound;
+    submitDecode(sound, filePath, jobManager);
+    return sound;
+}
+
+void SoundManager::submitDecode(const std::shared_ptr<Sound>& sound, const std::filesystem::path& filePath, JobManager& jobManager) {
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        ++pendingDecodeCount_;
+    }
+
+    jobManager.submit([this, sound, filePath] {
+        DecodedSound& scratch = getDecodeScratch();
+        PendingUpload upload{.sound = sound, .path = filePath, .pcm = {}, .isDecoded = decodeSound(filePath, scratch)};
+        if (upload.isDecoded) {
+            // 스크래치는 이 작업 스레드의 다음 디코딩이 다시 쓰므로, 메인 스레드로 넘길 PCM만 딱 맞는 크기로 복사함
+            upload.pcm = scratch;
+        }
+
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        decodedSounds_.push_back(std::move(upload));
+        --pendingDecodeCount_;
+        pendingIdle_.notify_all();
+    });
+}
+
+bool SoundManager::preloadSounds(const std::vector<std::filesystem::path>& filePaths, JobManager& jobManager) {
+    std::vector<std::filesystem::path> pending;
+    for (const auto& filePath : filePaths) {
+        if (auto it = soundCache_.find(filePath); it != soundCache_.end()) {
+            // 내려간 사운드는 같은 핸들로 다시 올림
+            if (it->second->getState() == Sound::State::EVICTED) {
+                pending.push_back(filePath);
+            } else {
+                ++cacheHits_;
+            }
+        } else if (std::find(pending.begin(), pending.end(), filePath) == pending.end()) {
+            pending.push_back(filePath);
+        }
+    }
+    cacheMisses_ += pending.size();
+
+    std::vector<DecodedSound> decoded(pending.size());
+    std::vector<char> isDecoded(pending.size(), 0);
+    jobManager.parallelFor(pending.size(), [&](size_t i) {
+        isDecoded[i] = isSupportedFormat(pending[i]) && decodeSound(pending[i], decoded[i]);
+    });
+
+    bool isAllLoaded = true;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        ALuint monoBuffer = 0, stereoBufferRight = 0;
+        if (isDecoded[i]) {
+            evictSounds(getByteSize(decoded[i]));
+        }
+        if (isDecoded[i] && uploadSound(decoded[i], monoBuffer, stereoBufferRight)) {
+            std::shared_ptr<Sound>& sound = soundCache_[pending[i]];
+            if (sound) {
+                sound->setBuffers(monoBuffer, stereoBufferRight, decoded[i].isStereo);
+            } else {
+                sound = std::make_shared<Sound>(monoBuffer, stereoBufferRight, decoded[i].isStereo);
+            }
+            markResident(*sound, pending[i], getByteSize(decoded[i]));
+        } else {
+            std::cerr << "Failed to preload sound: " << pending[i].string() << std::endl;
+            isAllLoaded = false;
+        }
+    }
+    return isAllLoaded;
+}
+
+void SoundManager::uploadPendingSounds() {
+    std::vector<PendingUpload> ready;
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (decodedSounds_.empty()) return;
+        ready.swap(decodedSounds_);
+    }
+
+    for (auto& upload : ready) {
+        ALuint monoBuffer = 0, stereoBufferRight = 0;
+        if (context_ && upload.isDecoded) {
+            evictSounds(getByteSize(upload.pcm));
+            if (uploadSound(upload.pcm, monoBuffer, stereoBufferRight)) {
+                upload.sound->setBuffers(monoBuffer, stereoBufferRight, upload.pcm.isStereo);
+                markResident(*upload.sound, upload.path, getByteSize(upload.pcm));
+                continue;
+            }
+        }
+        std::cerr << "Failed to load sound: " << upload.path.string() << std::endl;
+        upload.sound->markFailed();
+        // 다음 getSound/loadSoundAsync가 다시 시도할 수 있도록 캐시에서 뺌
+        if (auto it = soundCache_.find(upload.path); it != soundCache_.end() && it->second == upload.sound) {
+            soundCache_.erase(it);
+        }
+    }
+}
+
+// --- 메모리 한도 ---
+
+void SoundManager::setMemoryBudget(size_t budgetBytes, JobManager* jobManager) {
+    memoryBudget_ = budgetBytes;
+    reloadJobManager_ = jobManager;
+    evictSounds(0);
+}
+
+void SoundManager::pinSound(const std::shared_ptr<Sound>& sound, bool isPinned) {
+    if (!sound) return;
+    sound->isPinned_ = isPinned;
+    if (isPinned) {
+        prepareSound(sound.get());
+    } else {
+        evictSounds(0);
+    }
+}
+
+bool SoundManager::prepareSound(Sound* sound) {
+    if (!sound) return false;
+    if (sound->getState() == Sound::State::EVICTED) {
+        auto it = soundCache_.find(sound->path_);
+        if (it == soundCache_.end() || it->second.get() != sound) {
+            sound->markFailed(); // 캐시에서 빠진 핸들. 다시 불러올 경로가 없음
+            return false;
+        }
+        ++cacheMisses_;
+        std::shared_ptr<Sound> owner = it->second;
+        reloadSound(owner, reloadJobManager_);
+    }
+    return sound->isReady();
+}
+
+/* jobManager가 있으면 같은 핸들을 LOADING으로 두고 비동기로, 없으면 그 자리에서 다시 디코딩해 올림. */
+void SoundManager::reloadSound(const std::shared_ptr<Sound>& sound, JobManager* jobManager) {
+    if (jobManager) {
+        sound->state_ = Sound::State::LOADING;
+        submitDecode(sound, sound->path_, *jobManager);
+        return;
+    }
+
+    DecodedSound& pcm = getDecodeScratch();
+    ALuint monoBuffer = 0, stereoBufferRight = 0;
+    if (decodeSound(sound->path_, pcm)) {
+        evictSounds(getByteSize(pcm));
+        if (uploadSound(pcm, monoBuffer, stereoBufferRight)) {
+            sound->setBuffers(monoBuffer, stereoBufferRight, pcm.isStereo);
+            markResident(*sound, sound->path_, getByteSize(pcm));
+            return;
+        }
+    }
+    std::cerr << "Failed to reload sound: " << sound->path_.string() << std::endl;
+    sound->markFailed();
+    if (auto it = soundCache_.find(sound->path_); it != soundCache_.end() && it->second == sound) {
+        soundCache_.erase(it);
+    }
+}
+
+void SoundManager::markResident(Sound& sound, const std::filesystem::path& filePath, size_t byteSize) {
+    sound.path_ = filePath;
+    sound.byteSize_ = byteSize;
+    sound.lastPlayed_ = ++cacheClock_;
+    residentBytes_ += byteSize;
+}
+
+/*
+ * 한도를 넘는 동안 올라가 있고, 고정되지 않고, 보이스에 물려 있지 않은 사운드 중 가장 오래전에 재생한 것을 내림.
+ * 캐시만 들고 있는 사운드는 지우고, 다른 곳(SoundComponent::SoundData::resource 등)이 들고 있으면 버퍼만 내려
+ * 핸들이 계속 유효하게 둠. 내릴 것이 없으면 한도를 넘은 채로 둠.
+ */
+void SoundManager::evictSounds(size_t incomingBytes) {
+    if (memoryBudget_ == 0) return;
+
+    while (residentBytes_ > 0 && residentBytes_ + incomingBytes > memoryBudget_) {
+        auto oldest = soundCache_.end();
+        for (auto it = soundCache_.begin(); it != soundCache_.end(); ++it) {
+            const Sound& sound = *it->second;
+            if (sound.isReady() && !sound.isPinned_ && sound.voiceCount_ == 0 &&
+                (oldest == soundCache_.end() || sound.lastPlayed_ < oldest->second->lastPlayed_)) {
+                oldest = it;
+            }
+        }
+        if (oldest == soundCache_.end()) {
+            return;
+        }
+
+        residentBytes_ -= oldest->second->byteSize_;
+        ++cacheEvictions_;
+        if (oldest->second.use_count() == 1) {
+            soundCache_.erase(oldest);
+        } else {
+            oldest->second->releaseBuffers();
+        }
+    }
+}
+
+SoundCacheStats SoundManager::getCacheStats() const {
+    SoundCacheStats stats;
+    stats.residentBytes = residentBytes_;
+    stats.budgetBytes = memoryBudget_;
+    stats.cachedCount = soundCache_.size();
+    for (const auto& [path, sound] : soundCache_) {
+        stats.residentCount += sound->isReady() ? 1 : 0;
+        stats.pinnedCount += sound->isPinned() ? 1 : 0;
+    }
+    stats.hits = cacheHits_;
+    stats.misses = cacheMisses_;
+    stats.evictions = cacheEvictions_;
+    return stats;
+}
+
+void SoundManager::resetCacheStats() {
+    cacheHits_ = 0;
+    cacheMisses_ = 0;
+    cacheEvictions_ = 0;
+}
+
 ALuint SoundManager::playSound(EntityID entityId, Sound* sound, Position position, SoundPriority priority, float volume, float pitch, bool loop, bool spatialized) {
-    if (!sound) return 0;
+    // 내려간 사운드는 다시 불러오기를 시작함. 비동기면 이번 요청은 0을 돌려줌
+    if (!prepareSound(sound)) return 0;
 
-    auto voiceIndexOpt = findAvailableVoice(priority);
+    auto voiceIndexOpt = acquireVoice(priority);
     if (!voiceIndexOpt) return 0;
     size_t i = *voiceIndexOpt;
+    activateVoice(i, priority);
+    sound->lastPlayed_ = ++cacheClock_;
+    ++sound->voiceCount_;
 
     bool is3DStereo = sound->isStereo() && spatialized;
 
@@ -192,40 +471,70 @@ void SoundManager::togglePauseSound(ALuint sourceId) {
 }
 
 void SoundManager::stopAllSounds() {
-    for (size_t i = 0; i < MAX_VOICES; ++i) {
-        if (arePlaying_[i]) {
-            releaseVoice(i);
-        }
+    while (!activeVoices_.empty()) {
+        releaseVoice(activeVoices_.back());
     }
 }
 
-std::optional<size_t> SoundManager::findAvailableVoice(SoundPriority priority) {
-    // 1. 사용 중이 아닌 보이스 검색
-    for (size_t i = 0; i < MAX_VOICES; ++i) {
-        if (!arePlaying_[i]) {
-            ALint state; alGetSourcei(sourceIdsLeft_[i], AL_SOURCE_STATE, &state);
-            if (state != AL_PLAYING && state != AL_PAUSED) {
-                return i;
+/* std::*_heap은 최대 힙이므로 비교를 뒤집어 (우선순위, 시작 순서)가 가장 작은 후보를 맨 위에 둠 */
+bool SoundManager::isLaterStealCandidate(const StealCandidate& a, const StealCandidate& b) {
+    return a.priority != b.priority ? a.priority > b.priority : a.sequence > b.sequence;
+}
+
+/*
+ * 빈 보이스가 있으면 스택에서 바로 꺼냄. 없으면 힙 맨 위의 (우선순위가 가장 낮고 가장 오래된) 보이스를 훔침.
+ * 힙에는 이미 반납된 보이스의 낡은 항목이 남아 있을 수 있으므로 시작 순서가 다르면 버리고 다음을 봄.
+ */
+std::optional<size_t> SoundManager::acquireVoice(SoundPriority priority) {
+    if (freeVoices_.empty()) {
+        while (!stealHeap_.empty()) {
+            const StealCandidate top = stealHeap_.front();
+            if (voiceSequences_[top.voice] != top.sequence) {
+                std::pop_heap(stealHeap_.begin(), stealHeap_.end(), isLaterStealCandidate);
+                stealHeap_.pop_back();
+                continue;
+            }
+            if (top.priority > priority) {
+                return std::nullopt; // 더 낮은 우선순위의 보이스가 없음
             }
+            std::pop_heap(stealHeap_.begin(), stealHeap_.end(), isLaterStealCandidate);
+            stealHeap_.pop_back();
+            releaseVoice(top.voice);
+            break;
         }
-    }
-    // 2. 훔칠 보이스 검색
-    size_t lowestPriorityIndex = -1;
-    SoundPriority lowestPriority = SoundPriority::CRITICAL;
-    for (size_t i = 0; i < MAX_VOICES; ++i) {
-        if (priorities_[i] <= priority && priorities_[i] <= lowestPriority) {
-            lowestPriority = priorities_[i];
-            lowestPriorityIndex = i;
+        if (freeVoices_.empty()) {
+            return std::nullopt;
         }
     }
-    if (lowestPriorityIndex != -1) {
-        releaseVoice(lowestPriorityIndex);
-        return lowestPriorityIndex;
+
+    const size_t i = freeVoices_.back();
+    freeVoices_.pop_back();
+    return i;
+}
+
+void SoundManager::activateVoice(size_t i, SoundPriority priority) {
+    voiceSequences_[i] = nextSequence_++;
+    activeSlots_[i] = static_cast<uint32_t>(activeVoices_.size());
+    activeVoices_.push_back(static_cast<uint32_t>(i));
+
+    // 훔치지 않고 끝나는 보이스가 많으면 낡은 항목이 쌓이므로, 커지면 사용 중인 보이스로 다시 만듦
+    if (stealHeap_.size() >= static_cast<size_t>(MAX_VOICES) * 2) {
+        stealHeap_.clear();
+        for (uint32_t voice : activeVoices_) {
+            stealHeap_.push_back({voice == i ? priority : priorities_[voice], voiceSequences_[voice], voice});
+        }
+        std::make_heap(stealHeap_.begin(), stealHeap_.end(), isLaterStealCandidate);
+        return;
     }
-    return std::nullopt;
+    stealHeap_.push_back({priority, voiceSequences_[i], static_cast<uint32_t>(i)});
+    std::push_heap(stealHeap_.begin(), stealHeap_.end(), isLaterStealCandidate);
 }
 
 void SoundManager::releaseVoice(size_t i) {
+    if (voiceSequences_[i] == 0) {
+        return; // 이미 비어 있음
+    }
+
     alSourceStop(sourceIdsLeft_[i]);
     alSourcei(sourceIdsLeft_[i], AL_BUFFER, 0);
     if (areSplitStereo_[i]) {
@@ -233,10 +542,100 @@ void SoundManager::releaseVoice(size_t i) {
         alSourcei(sourceIdsRight_[i], AL_BUFFER, 0);
     }
     arePlaying_[i] = false;
+    if (sounds_[i] && sounds_[i]->voiceCount_ > 0) {
+        --sounds_[i]->voiceCount_;
+    }
     sounds_[i] = nullptr;
     priorities_[i] = SoundPriority::LOW;
     ownerEntityIds_[i] = 0;
     areSplitStereo_[i] = false;
+
+    voiceSequences_[i] = 0;
+    const uint32_t slot = activeSlots_[i];
+    const uint32_t last = activeVoices_.back();
+    activeVoices_[slot] = last;
+    activeSlots_[last] = slot;
+    activeVoices_.pop_back();
+    freeVoices_.push_back(static_cast<uint32_t>(i));
+}
+
+void SoundManager::syncVoices() {
+    finishedVoices_.clear();
+
+    if (isUsingSourceEvents_) {
+        {
+            std::lock_guard<std::mutex> lock(stoppedSourcesMutex_);
+            stoppedSourcesScratch_.swap(stoppedSources_);
+        }
+        for (ALuint sourceId : stoppedSourcesScratch_) {
+            if (auto it = sourceIdToIndexMap_.find(sourceId); it != sourceIdToIndexMap_.end()) {
+                retireIfStopped(it->second);
+            }
+        }
+        stoppedSourcesScratch_.clear();
+        return;
+    }
+
+    // 반납하면 맨 뒤 항목이 지운 자리로 오므로 뒤에서부터 돌아야 건너뛰는 보이스가 없음
+    for (size_t k = activeVoices_.size(); k-- > 0;) {
+        retireIfStopped(activeVoices_[k]);
+    }
+}
+
+/*
+ * 이벤트는 우리가 직접 멈춘 소스에 대해서도 늦게 도착할 수 있으므로, 보이스가 사용 중이고 실제로 멈춰 있을 때만 반납함.
+ */
+void SoundManager::retireIfStopped(size_t i) {
+    if (voiceSequences_[i] == 0) {
+        return;
+    }
+    ALint state;
+    alGetSourcei(sourceIdsLeft_[i], AL_SOURCE_STATE, &state);
+    if (state == AL_STOPPED) {
+        finishedVoices_.push_back({sourceIdsLeft_[i], ownerEntityIds_[i]});
+        releaseVoice(i);
+    }
+}
+
+bool SoundManager::enableSourceEvents() {
+    if (!alIsExtensionPresent("AL_SOFT_events")) {
+        return false;
+    }
+    auto eventControl = reinterpret_cast<LPALEVENTCONTROLSOFT>(alGetProcAddress("alEventControlSOFT"));
+    auto eventCallback = reinterpret_cast<LPALEVENTCALLBACKSOFT>(alGetProcAddress("alEventCallbackSOFT"));
+    if (!eventControl || !eventCallback) {
+        return false;
+    }
+
+    eventCallback(&SoundManager::onSourceEvent, this);
+    const ALenum types[] = {AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT};
+    eventControl(1, types, AL_TRUE);
+    return alGetError() == AL_NO_ERROR;
+}
+
+void SoundManager::disableSourceEvents() {
+    if (!isUsingSourceEvents_) {
+        return;
+    }
+    auto eventControl = reinterpret_cast<LPALEVENTCONTROLSOFT>(alGetProcAddress("alEventControlSOFT"));
+    auto eventCallback = reinterpret_cast<LPALEVENTCALLBACKSOFT>(alGetProcAddress("alEventCallbackSOFT"));
+    const ALenum types[] = {AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT};
+    eventControl(1, types, AL_FALSE);
+    eventCallback(nullptr, nullptr);
+    isUsingSourceEvents_ = false;
+
+    std::lock_guard<std::mutex> lock(stoppedSourcesMutex_);
+    stoppedSources_.clear();
+}
+
+/* OpenAL 이벤트 스레드에서 불림. 멈춘 소스 ID만 넣고 나머지는 syncVoices에서 처리함. */
+void AL_APIENTRY SoundManager::onSourceEvent(ALenum eventType, ALuint object, ALuint param, ALsizei, const ALchar*, void* userParam) noexcept {
+    if (eventType != AL_EVENT_TYPE_SOURCE_STATE_CHANGED_SOFT || param != AL_STOPPED) {
+        return;
+    }
+    auto* self = static_cast<SoundManager*>(userParam);
+    std::lock_guard<std::mutex> lock(self->stoppedSourcesMutex_);
+    self->stoppedSources_.push_back(object);
 }
 
 void SoundManager::setListenerPosition(float x, float y, float z) {
@@ -278,9 +677,103 @@ void SoundManager::setSourcePitch(ALuint sourceId, float pitch) {
     }
 }
 
-// --- 파일 로더 함수들은 변경 없음 (생략) ---
+std::shared_ptr<SoundStream> SoundManager::openStream(const std::filesystem::path& filePath) {
+    if (!context_) return nullptr;
+
+    auto stream = SoundStream::open(filePath);
+    if (!stream) return nullptr;
+
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    streams_.push_back(stream);
+    if (!isStreamThreadRunning_) {
+        isStreamThreadRunning_ = true;
+        streamThread_ = std::thread(&SoundManager::streamThreadLoop, this);
+    }
+    return stream;
+}
+
+void SoundManager::stopAllStreams() {
+    std::lock_guard<std::mutex> lock(streamMutex_);
+    for (auto& weakStream : streams_) {
+        if (auto stream = weakStream.lock()) {
+            stream->stop();
+        }
+    }
+}
+
+/*
+ * 스트리밍 스레드 본체. 주기마다 살아 있는 스트림을 모아 streamMutex_ 밖에서 update를 부름.
+ * 디코딩은 여기서만 일어나므로 메인 스레드의 프레임 시간에 들어가지 않음.
+ */
+void SoundManager::streamThreadLoop() {
+    std::vector<std::shared_ptr<SoundStream>> active;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(streamMutex_);
+            streamCondition_.wait_for(lock, std::chrono::milliseconds(STREAM_UPDATE_INTERVAL_MS), [this] { return !isStreamThreadRunning_; });
+            if (!isStreamThreadRunning_) break;
+
+            streams_.erase(std::remove_if(streams_.begin(), streams_.end(), [](const std::weak_ptr<SoundStream>& s) { return s.expired(); }), streams_.end());
+            for (auto& weakStream : streams_) {
+                if (auto stream = weakStream.lock()) active.push_back(std::move(stream));
+            }
+        }
+
+        for (auto& stream : active) {
+            stream->update();
+        }
+        active.clear();
+    }
+}
 
-bool SoundManager::loadWav(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo) {
+void SoundManager::stopStreamThread() {
+    {
+        std::lock_guard<std::mutex> lock(streamMutex_);
+        if (!isStreamThreadRunning_) return;
+        isStreamThreadRunning_ = false;
+    }
+    streamCondition_.notify_all();
+    if (streamThread_.joinable()) {
+        streamThread_.join();
+    }
+}
+
+// --- 파일 디코더 함수들 ---
+
+bool SoundManager::isSupportedFormat(const std::filesystem::path& filePath) {
+    std::string ext = filePath.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+    return ext == ".wav" || ext == ".mp3" || ext == ".ogg" || ext == ".flac";
+}
+
+SoundManager::DecodedSound& SoundManager::getDecodeScratch() {
+    thread_local DecodedSound scratch;
+    return scratch;
+}
+
+bool SoundManager::decodeSound(const std::filesystem::path& filePath, DecodedSound& out) {
+    std::string ext = filePath.extension().string();
+    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+    // 재사용하는 스크래치일 수 있으므로 모노 디코딩에 이전 소리의 오른쪽 채널이 남지 않게 비움(용량은 유지됨)
+    out.right.clear();
+    out.isStereo = false;
+
+    if (ext == ".wav") { return decodeWav(filePath, out); }
+    else if (ext == ".mp3") { return decodeMp3(filePath, out); }
+    else if (ext == ".ogg") { return decodeOgg(filePath, out); }
+    else if (ext == ".flac") { return decodeFlac(filePath, out); }
+    return false;
+}
+
+void SoundManager::splitStereo(const short* interleaved, size_t frameCount, DecodedSound& out) {
+    out.isStereo = true;
+    out.left.resize(frameCount);
+    out.right.resize(frameCount);
+    PcmConvert::deinterleaveStereo(interleaved, out.left.data(), out.right.data(), frameCount);
+}
+
+bool SoundManager::decodeWav(const std::filesystem::path& filePath, DecodedSound& out) {
     unsigned int channels;
     unsigned int sampleRate;
     drwav_uint64 totalPcmFrameCount;
@@ -290,113 +783,94 @@ bool SoundManager::loadWav(const std::filesystem::path& filePath, ALuint& monoBu
         return false;
     }
 
+    bool isDecoded = true;
+    out.sampleRate = sampleRate;
     if (channels == 1) { // 모노
-        isStereo = false;
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pData, totalPcmFrameCount * sizeof(short), sampleRate);
+        out.isStereo = false;
+        out.left.assign(pData, pData + totalPcmFrameCount);
     } else if (channels == 2) { // 스테레오
-        isStereo = true;
-        std::vector<short> pcmLeft(totalPcmFrameCount);
-        std::vector<short> pcmRight(totalPcmFrameCount);
-        for (drwav_uint64 i = 0; i < totalPcmFrameCount; ++i) {
-            pcmLeft[i] = pData[i * 2];
-            pcmRight[i] = pData[i * 2 + 1];
-        }
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcmLeft.data(), pcmLeft.size() * sizeof(short), sampleRate);
-        alGenBuffers(1, &stereoBufferRight);
-        alBufferData(stereoBufferRight, AL_FORMAT_MONO16, pcmRight.data(), pcmRight.size() * sizeof(short), sampleRate);
+        splitStereo(pData, totalPcmFrameCount, out);
     } else {
         std::cerr << "Unsupported WAV channel count: " << channels << "\n";
-        drwav_free(pData, NULL);
-        return false;
+        isDecoded = false;
     }
     drwav_free(pData, NULL);
-    AL_CHECK_ERROR();
-    return true;
+    return isDecoded;
 }
 
-bool SoundManager::loadMp3(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo) {
+bool SoundManager::decodeMp3(const std::filesystem::path& filePath, DecodedSound& out) {
     drmp3_config config;
     drmp3_uint64 totalPcmFrameCount;
     float* pPcmData = drmp3_open_file_and_read_pcm_frames_f32(filePath.string().c_str(), &config, &totalPcmFrameCount, NULL);
     if (pPcmData == NULL) { return false; }
 
-    std::vector<short> pcm16(totalPcmFrameCount * config.channels);
-    for (drmp3_uint64 i = 0; i < totalPcmFrameCount * config.channels; ++i) {
-        pcm16[i] = static_cast<short>(pPcmData[i] * 32767.0f);
-    }
-    drmp3_free(pPcmData, NULL);
-
+    // s16 변환과 채널 분리를 한 번에 해서 중간 s16 버퍼를 만들지 않음
+    bool isDecoded = true;
+    out.sampleRate = config.sampleRate;
     if (config.channels == 1) {
-        isStereo = false;
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcm16.data(), pcm16.size() * sizeof(short), config.sampleRate);
+        out.isStereo = false;
+        out.left.resize(totalPcmFrameCount);
+        PcmConvert::floatToS16(pPcmData, out.left.data(), totalPcmFrameCount);
     } else if (config.channels == 2) {
-        isStereo = true;
-        std::vector<short> pcmLeft(totalPcmFrameCount);
-        std::vector<short> pcmRight(totalPcmFrameCount);
-        for (drmp3_uint64 i = 0; i < totalPcmFrameCount; ++i) {
-            pcmLeft[i] = pcm16[i * 2];
-            pcmRight[i] = pcm16[i * 2 + 1];
-        }
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcmLeft.data(), pcmLeft.size() * sizeof(short), config.sampleRate);
-        alGenBuffers(1, &stereoBufferRight);
-        alBufferData(stereoBufferRight, AL_FORMAT_MONO16, pcmRight.data(), pcmRight.size() * sizeof(short), config.sampleRate);
-    } else { return false; }
-    AL_CHECK_ERROR();
-    return true;
+        out.isStereo = true;
+        out.left.resize(totalPcmFrameCount);
+        out.right.resize(totalPcmFrameCount);
+        PcmConvert::floatStereoToS16Planar(pPcmData, out.left.data(), out.right.data(), totalPcmFrameCount);
+    } else { isDecoded = false; }
+    drmp3_free(pPcmData, NULL);
+    return isDecoded;
 }
 
-bool SoundManager::loadFlac(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo) {
+bool SoundManager::decodeFlac(const std::filesystem::path& filePath, DecodedSound& out) {
     unsigned int channels, sampleRate;
     drflac_uint64 totalPcmFrameCount;
     short* pData = drflac_open_file_and_read_pcm_frames_s16(filePath.string().c_str(), &channels, &sampleRate, &totalPcmFrameCount, NULL);
     if (pData == NULL) return false;
 
+    bool isDecoded = true;
+    out.sampleRate = sampleRate;
     if (channels == 1) {
-        isStereo = false;
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pData, totalPcmFrameCount * sizeof(short), sampleRate);
+        out.isStereo = false;
+        out.left.assign(pData, pData + totalPcmFrameCount);
     } else if (channels == 2) {
-        isStereo = true;
-        std::vector<short> pcmLeft(totalPcmFrameCount), pcmRight(totalPcmFrameCount);
-        for (drflac_uint64 i = 0; i < totalPcmFrameCount; ++i) { pcmLeft[i] = pData[i * 2]; pcmRight[i] = pData[i * 2 + 1]; }
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcmLeft.data(), pcmLeft.size() * sizeof(short), sampleRate);
-        alGenBuffers(1, &stereoBufferRight);
-        alBufferData(stereoBufferRight, AL_FORMAT_MONO16, pcmRight.data(), pcmRight.size() * sizeof(short), sampleRate);
-    } else { drflac_free(pData, NULL); return false; }
+        splitStereo(pData, totalPcmFrameCount, out);
+    } else { isDecoded = false; }
     drflac_free(pData, NULL);
-    AL_CHECK_ERROR();
-    return true;
+    return isDecoded;
 }
 
-bool SoundManager::loadOgg(const std::filesystem::path& filePath, ALuint& monoBuffer, ALuint& stereoBufferRight, bool& isStereo) {
+bool SoundManager::decodeOgg(const std::filesystem::path& filePath, DecodedSound& out) {
     int channels, sample_rate, samples;
     short* pcm;
     samples = stb_vorbis_decode_filename(filePath.string().c_str(), &channels, &sample_rate, &pcm);
     if (samples == -1) return false;
 
+    bool isDecoded = true;
+    out.sampleRate = static_cast<unsigned int>(sample_rate);
     if (channels == 1) {
-        isStereo = false;
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcm, samples * sizeof(short), sample_rate);
+        out.isStereo = false;
+        out.left.assign(pcm, pcm + samples);
     } else if (channels == 2) {
-        isStereo = true;
-        std::vector<short> pcmLeft(samples), pcmRight(samples);
-        for (int i = 0; i < samples; ++i) { pcmLeft[i] = pcm[i * 2]; pcmRight[i] = pcm[i * 2 + 1]; }
-        alGenBuffers(1, &monoBuffer);
-        alBufferData(monoBuffer, AL_FORMAT_MONO16, pcmLeft.data(), pcmLeft.size() * sizeof(short), sample_rate);
-        alGenBuffers(1, &stereoBufferRight);
-        alBufferData(stereoBufferRight, AL_FORMAT_MONO16, pcmRight.data(), pcmRight.size() * sizeof(short), sample_rate);
-    } else { free(pcm); return false; }
+        splitStereo(pcm, static_cast<size_t>(samples), out);
+    } else { isDecoded = false; }
     free(pcm);
-    AL_CHECK_ERROR();
-    return true;
+    return isDecoded;
 }
 
+bool SoundManager::uploadSound(const DecodedSound& pcm, ALuint& monoBuffer, ALuint& stereoBufferRight) {
+    alGenBuffers(1, &monoBuffer);
+    alBufferData(monoBuffer, AL_FORMAT_MONO16, pcm.left.data(), static_cast<ALsizei>(pcm.left.size() * sizeof(short)), static_cast<ALsizei>(pcm.sampleRate));
+    if (pcm.isStereo) {
+        alGenBuffers(1, &stereoBufferRight);
+        alBufferData(stereoBufferRight, AL_FORMAT_MONO16, pcm.right.data(), static_cast<ALsizei>(pcm.right.size() * sizeof(short)), static_cast<ALsizei>(pcm.sampleRate));
+    }
 
-
-
+    if (alGetError() != AL_NO_ERROR) {
+        std::cerr << "Failed to upload sound buffer." << std::endl;
+        if (monoBuffer != 0) alDeleteBuffers(1, &monoBuffer);
+        if (stereoBufferRight != 0) alDeleteBuffers(1, &stereoBufferRight);
+        monoBuffer = stereoBufferRight = 0;
+        return false;
+    }
+    return true;
+}
@@ -8,38 +8,21 @@ TextManager::TextManager(SDL_Renderer* renderer) : renderer_(renderer) {
 }
 
 TextManager::~TextManager() {
-    for (auto const& [id, font] : fontMap_) {
-        TTF_CloseFont(font);
-    }
+    // 아틀라스 -> 페이스 -> 파일 데이터 순으로 정리. TTF_Quit 전에 모든 폰트가 닫혀야 함.
+    glyphAtlases_.clear();
+    faces_.clear();
+    lru_.clear();
     TTF_Quit();
     std::cerr << "TextManager "<< this << " is successfully destroyed and all fonts unloaded." << std::endl;
 }
 
 bool TextManager::loadFont(const std::filesystem::path& filePath, int fontPointSize) {
-    // 이미 로드된 폰트인지 확인
-    if (fontMap_.count(filePath)) {
-        SDL_Log("Font already loaded: %s", filePath.string().c_str());
-        return true; // 이미 로드되어 있다면 성공으로 간주
-    }
-
-    TTF_Font* font = TTF_OpenFont(filePath.string().c_str(), fontPointSize);
-    if (!font) {
-        SDL_Log("Failed to load font %s: %s", filePath.string().c_str(), SDL_GetError());
-        return false;
-    }
-
-    fontMap_[filePath] = font; /* 폰트 map에 저장 */
-    return true;
+    return getFontFace(filePath, fontPointSize) != nullptr;
 }
 
 bool TextManager::setFontSizePt(const std::filesystem::path& filePath, int fontPointSize) {
-    auto it = fontMap_.find(filePath);
-    if (it == fontMap_.end()) {
-        SDL_Log("setFontSizePt - Font not found: %s", filePath.string().c_str());
-        return false;
-    }
-    if (!TTF_SetFontSize(it->second, fontPointSize)) {
-        SDL_Log("setFontSizePt - Failed to set font size for %s: %s", filePath.string().c_str(), SDL_GetError());
+    if (!getFontFace(filePath, fontPointSize)) {
+        SDL_Log("setFontSizePt - Failed to load font %s at %dpt", filePath.string().c_str(), fontPointSize);
         return false;
     }
     return true;
@@ -65,16 +48,108 @@ std::string TextManager::loadTextFromFile(const std::filesystem::path& filePath)
     return buffer.str(); /* string으로 반환 */
 }
 
-TTF_Font* TextManager::getFont(const std::filesystem::path& filePath, int fontPointSize) {
-    auto it = fontMap_.find(filePath);
-    if (it != fontMap_.end()) {
-        return it->second;
+/*
+ * @brief 폰트 파일을 메모리에 올림. 이미 올라가 있으면 공유함.
+ *        파일 데이터는 그것을 쓰는 페이스가 모두 해제되면 함께 해제됨.
+ */
+std::shared_ptr<const FontFileData> TextManager::loadFontFile(const std::filesystem::path& filePath) {
+    auto it = fontFiles_.find(filePath);
+    if (it != fontFiles_.end()) {
+        if (auto data = it->second.lock()) {
+            return data;
+        }
     }
-    // If not found, try to load it
-    if (loadFont(filePath, fontPointSize)) {
-        return fontMap_.at(filePath);
+
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        SDL_Log("TextManager::loadFontFile - Failed to open font file: %s", filePath.string().c_str());
+        return nullptr;
     }
-    return nullptr;
+
+    auto data = std::make_shared<FontFileData>();
+    data->path = filePath;
+    data->bytes.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data->bytes.data()), static_cast<std::streamsize>(data->bytes.size()));
+
+    ++stats_.fileLoads;
+    fontFiles_[filePath] = data;
+    return data;
 }
 
+std::shared_ptr<FontFace> TextManager::getFontFace(const std::filesystem::path& filePath, int fontPointSize, int style) {
+    FontKey key{filePath, fontPointSize, style};
+
+    auto it = faces_.find(key);
+    if (it != faces_.end()) {
+        ++stats_.hits;
+        lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+        return it->second.face;
+    }
+    ++stats_.misses;
+
+    auto fileData = loadFontFile(filePath);
+    if (!fileData) {
+        return nullptr;
+    }
 
+    auto face = std::make_shared<FontFace>(std::move(fileData), fontPointSize, style);
+    if (!face->isValid()) {
+        return nullptr;
+    }
+
+    lru_.push_front(key);
+    faces_.emplace(std::move(key), FaceEntry{face, lru_.begin()});
+    evictUnused();
+    return face;
+}
+
+TTF_Font* TextManager::getFont(const std::filesystem::path& filePath, int fontPointSize, int style) {
+    auto face = getFontFace(filePath, fontPointSize, style);
+    return face ? face->getFont() : nullptr;
+}
+
+/*
+ * @brief 캐시가 상한을 넘으면 오래된 페이스부터 해제함.
+ *        캐시 밖에서 shared_ptr을 잡고 있는 페이스(아틀라스 포함)는 건너뜀.
+ */
+void TextManager::evictUnused() {
+    auto it = lru_.end();
+    while (faces_.size() > maxCachedFaces_ && it != lru_.begin()) {
+        --it;
+        auto faceIt = faces_.find(*it);
+        if (faceIt->second.face.use_count() > 1) {
+            continue;
+        }
+        faces_.erase(faceIt);
+        it = lru_.erase(it);
+        ++stats_.evictions;
+    }
+}
+
+FontCacheStats TextManager::getCacheStats() const {
+    FontCacheStats stats = stats_;
+    stats.cachedFaces = faces_.size();
+    return stats;
+}
+
+GlyphAtlas* TextManager::getGlyphAtlas(const std::filesystem::path& filePath, int fontPointSize) {
+    auto key = std::make_pair(filePath, fontPointSize);
+    auto it = glyphAtlases_.find(key);
+    if (it != glyphAtlases_.end()) {
+        return it->second.atlas.get();
+    }
+
+    auto face = getFontFace(filePath, fontPointSize);
+    if (!face) {
+        SDL_Log("TextManager::getGlyphAtlas - Failed to load font %s (%dpt)", filePath.string().c_str(), fontPointSize);
+        return nullptr;
+    }
+
+    AtlasEntry entry;
+    entry.atlas = std::make_unique<GlyphAtlas>(renderer_, face->getFont());
+    entry.face = std::move(face);
+    GlyphAtlas* atlas = entry.atlas.get();
+    glyphAtlases_.emplace(std::move(key), std::move(entry));
+    return atlas;
+}
@@ -3,16 +3,30 @@
 #include <iostream>
 #include <filesystem>
 #include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #include <SDL3/SDL_render.h>
 #include <SDL3_image/SDL_image.h>
 
 #include "GNEngine/resource/embedded/image/ImageError.h"
+#include "GNEngine/manager/JobManager.h"
 
 TextureManager::TextureManager(SDL_Renderer* renderer)
     : renderer_(renderer) {
     if (!renderer) {
         SDL_Log("TextureManager::init - rawRenderer is null: %s", SDL_GetError());
+    } else {
+        // 렌더러가 지원하는 텍스처 포맷 중 알파가 있는 첫 번째(가장 선호하는) 포맷을 고름
+        const auto* formats = static_cast<const SDL_PixelFormat*>(
+            SDL_GetPointerProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_TEXTURE_FORMATS_POINTER, nullptr));
+        for (const SDL_PixelFormat* format = formats; format && *format != SDL_PIXELFORMAT_UNKNOWN; ++format) {
+            if (SDL_ISPIXELFORMAT_ALPHA(*format)) {
+                preferredFormat_ = *format;
+                break;
+            }
+        }
     }
 
     /* --- Load embedded images. --- */
@@ -25,6 +39,7 @@ TextureManager::TextureManager(SDL_Renderer* renderer)
 }
 
 TextureManager::~TextureManager() {
+    disableScaledVariants();
     textureMap_.clear();
     std::cerr << "TextureManager " << this << " is successfully destroyed" << std::endl;
 }
@@ -45,18 +60,110 @@ bool TextureManager::loadTexture(const std::filesystem::path& filePath) {
         return false;
     }
 
-    SDL_Texture* sdlTexture = SDL_CreateTextureFromSurface(renderer_, tmpSurface);
+    SDL_Surface* prepared = prepareSurface(tmpSurface, filePath.string());
     SDL_DestroySurface(tmpSurface);
+    return addTextureFromSurface(filePath, prepared);
+}
+
+/*
+ * @brief 여러 파일을 jobManager에서 병렬로 디코딩하고 렌더러 포맷/프리멀티플라이드 알파로 변환한 뒤 텍스처로 만듦.
+ *        텍스처 생성은 SDL 렌더 API 제약 때문에 호출한 스레드에서 차례로 함.
+ * @return 모두 성공하면 true.
+ */
+bool TextureManager::preloadTextures(const std::vector<std::filesystem::path>& filePaths, JobManager& jobManager) {
+    std::vector<std::filesystem::path> pending;
+    for (const auto& filePath : filePaths) {
+        if (!textureMap_.count(filePath) && std::find(pending.begin(), pending.end(), filePath) == pending.end()) {
+            pending.push_back(filePath);
+        }
+    }
+
+    const uint64_t conversionsBefore = conversionCount_.load();
+    const uint64_t conversionNsBefore = conversionTimeNs_.load();
+    const uint64_t start = SDL_GetTicksNS();
+
+    std::vector<SDL_Surface*> prepared(pending.size(), nullptr);
+    jobManager.parallelFor(pending.size(), [&](size_t i) {
+        SDL_Surface* surface = IMG_Load(pending[i].string().c_str());
+        if (!surface) {
+            SDL_Log("TextureManager::preloadTextures - Failed to load surface %s: %s", pending[i].string().c_str(), SDL_GetError());
+            return;
+        }
+        prepared[i] = prepareSurface(surface, pending[i].string());
+        SDL_DestroySurface(surface);
+    });
+
+    bool isAllLoaded = true;
+    for (size_t i = 0; i < pending.size(); ++i) {
+        isAllLoaded = addTextureFromSurface(pending[i], prepared[i]) && isAllLoaded;
+    }
+
+    SDL_Log("TextureManager::preloadTextures - Loaded %zu textures in %.2f ms (%llu format conversions, %.2f ms converting across workers)",
+            pending.size(), (SDL_GetTicksNS() - start) / 1.0e6,
+            static_cast<unsigned long long>(conversionCount_.load() - conversionsBefore),
+            (conversionTimeNs_.load() - conversionNsBefore) / 1.0e6);
+    return isAllLoaded;
+}
 
+/*
+ * @brief 디코딩된 서피스를 렌더러가 선호하는 포맷으로 바꾸고 알파를 미리 곱함. 원본은 건드리지 않고 새 서피스를 돌려줌.
+ *        렌더러 상태를 쓰지 않으므로 작업 스레드에서 호출해도 됨.
+ */
+SDL_Surface* TextureManager::prepareSurface(SDL_Surface* surface, const std::string& name) {
+    const uint64_t start = SDL_GetTicksNS();
+    const SDL_PixelFormat sourceFormat = surface->format;
+
+    SDL_Surface* converted = SDL_ConvertSurface(surface, preferredFormat_);
+    if (!converted) {
+        SDL_Log("TextureManager::prepareSurface - Failed to convert %s: %s", name.c_str(), SDL_GetError());
+        return nullptr;
+    }
+    if (!SDL_PremultiplySurfaceAlpha(converted, false)) {
+        SDL_Log("TextureManager::prepareSurface - Failed to premultiply %s: %s", name.c_str(), SDL_GetError());
+        SDL_DestroySurface(converted);
+        return nullptr;
+    }
+
+    const uint64_t elapsed = SDL_GetTicksNS() - start;
+    conversionTimeNs_ += elapsed;
+    if (sourceFormat != preferredFormat_) {
+        ++conversionCount_;
+        SDL_Log("TextureManager::prepareSurface - %s: %s -> %s (premultiplied) in %.3f ms", name.c_str(),
+                SDL_GetPixelFormatName(sourceFormat), SDL_GetPixelFormatName(preferredFormat_), elapsed / 1.0e6);
+    }
+    return converted;
+}
+
+/* prepareSurface 결과로 텍스처를 만들어 key로 등록하고 서피스를 해제함. surface가 nullptr이면 실패로 봄. */
+bool TextureManager::addTextureFromSurface(const std::filesystem::path& key, SDL_Surface* surface) {
+    if (!surface) {
+        return false;
+    }
+
+    SDL_Texture* sdlTexture = SDL_CreateTextureFromSurface(renderer_, surface);
     if (sdlTexture == nullptr) {
-        SDL_Log("TextureManager::loadTexture - Failed to create texture from surface %s: %s", filePath.string().c_str(), SDL_GetError());
+        SDL_Log("TextureManager::addTextureFromSurface - Failed to create texture from surface %s: %s", key.string().c_str(), SDL_GetError());
+        SDL_DestroySurface(surface);
         return false;
     }
+    SDL_SetTextureBlendMode(sdlTexture, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDL_SetBooleanProperty(SDL_GetTextureProperties(sdlTexture), PREMULTIPLIED_PROPERTY, true);
+
+    if (isVariantEnabled_) {
+        keepVariantSource(sdlTexture, surface);
+    }
+    const int width = surface->w;
+    const int height = surface->h;
+    SDL_DestroySurface(surface);
 
-    textureMap_[filePath] = std::make_unique<Texture>(sdlTexture, sdlTexture->w, sdlTexture->h);
+    textureMap_[key] = std::make_unique<Texture>(sdlTexture, width, height);
     return true;
 }
 
+bool TextureManager::isPremultiplied(SDL_Texture* texture) {
+    return texture && SDL_GetBooleanProperty(SDL_GetTextureProperties(texture), PREMULTIPLIED_PROPERTY, false);
+}
+
 /* 
  * @brief GNEngine 내장 이미지를 로딩함.
 */
@@ -71,19 +178,15 @@ bool TextureManager::loadTextureEmbedded(const std::string& name, const unsigned
         return false;
     }
 
-    SDL_Texture* sdlTexture = IMG_LoadTexture_IO(renderer_, io, true);
-    if (sdlTexture == nullptr) {
+    SDL_Surface* surface = IMG_Load_IO(io, true);
+    if (surface == nullptr) {
         SDL_Log("Failed to load embedded texture %s: %s", name.c_str(), SDL_GetError());
         return false;
     }
 
-    float width_f, height_f;
-    SDL_GetTextureSize(sdlTexture, &width_f, &height_f);
-    int width = static_cast<int>(width_f);
-    int height = static_cast<int>(height_f);
- 
-    textureMap_[name] = std::make_unique<Texture>(sdlTexture, width, height);
-    return true;
+    SDL_Surface* prepared = prepareSurface(surface, name);
+    SDL_DestroySurface(surface);
+    return addTextureFromSurface(name, prepared);
 }
 
 Texture* TextureManager::getTexture(const std::filesystem::path& filePath) {
@@ -120,4 +223,255 @@ void TextureManager::setScaleModeOfTexture(const std::filesystem::path& textureP
         // Even if setting scale mode fails, we still want to use the texture if it was created successfully.
         // This log helps diagnose, but doesn't prevent texture usage.
     }
-}
\ No newline at end of file
+}
+
+void TextureManager::enableScaledVariants(JobManager* jobManager, size_t memoryBudgetBytes, ScaleFilter filter) {
+    isVariantEnabled_ = true;
+    variantJobs_ = jobManager;
+    variantBudget_ = memoryBudgetBytes;
+    variantFilter_ = filter;
+}
+
+/* 축소본 텍스처와 보관한 원본 픽셀을 모두 해제함. 진행 중인 작업의 결과는 새 큐로 바꿔 버림. */
+void TextureManager::disableScaledVariants() {
+    releaseRetiredVariants();
+    for (auto& [texture, set] : variantSets_) {
+        for (Variant& variant : set.levels) {
+            if (variant.texture) {
+                SDL_DestroyTexture(variant.texture);
+            }
+        }
+    }
+    variantSets_.clear();
+    variantMemory_ = 0;
+    variantQueue_ = std::make_shared<VariantQueue>();
+    isVariantEnabled_ = false;
+}
+
+void TextureManager::keepVariantSource(SDL_Texture* texture, SDL_Surface* surface) {
+    SDL_Surface* converted = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_ARGB8888);
+    if (!converted) {
+        SDL_Log("TextureManager::keepVariantSource - Failed to convert surface: %s", SDL_GetError());
+        return;
+    }
+
+    auto source = std::make_shared<SourceImage>();
+    source->width = converted->w;
+    source->height = converted->h;
+    source->pixels.resize(static_cast<size_t>(converted->w) * converted->h);
+    SDL_LockSurface(converted);
+    for (int row = 0; row < converted->h; ++row) {
+        std::memcpy(source->pixels.data() + static_cast<size_t>(row) * converted->w,
+                    static_cast<const uint8_t*>(converted->pixels) + static_cast<size_t>(row) * converted->pitch,
+                    static_cast<size_t>(converted->w) * sizeof(uint32_t));
+    }
+    SDL_UnlockSurface(converted);
+    SDL_DestroySurface(converted);
+
+    variantSets_[texture].source = std::move(source);
+}
+
+/*
+ * 축소 배율이 1/2^level이면, 축소본이 그릴 크기보다 작아지지 않는 가장 큰 level을 고름.
+ * 예: scale 0.3 -> 1/2 축소본(0.5)을 0.6배로 그림.
+ */
+SDL_Texture* TextureManager::getScaledVariant(SDL_Texture* texture, float scale, float& outScaleX, float& outScaleY) {
+    outScaleX = outScaleY = 1.0f;
+    if (!isVariantEnabled_ || scale > 0.5f || scale <= 0.0f) {
+        return texture;
+    }
+    auto it = variantSets_.find(texture);
+    if (it == variantSets_.end()) {
+        return texture;
+    }
+
+    if (variantQueue_->readyCount.load(std::memory_order_acquire) > 0) {
+        uploadReadyVariants();
+    }
+
+    const int level = std::min(static_cast<int>(std::floor(std::log2(1.0f / scale))), MAX_VARIANT_LEVEL);
+    VariantSet& set = it->second;
+    Variant& variant = set.levels[level];
+    if (!variant.texture) {
+        requestVariant(texture, set, level);
+        if (!variant.texture) {
+            return texture;
+        }
+    }
+
+    variant.lastUsed = ++variantUseTick_;
+    const SourceImage& source = *set.source;
+    outScaleX = static_cast<float>(std::max(source.width >> level, 1)) / source.width;
+    outScaleY = static_cast<float>(std::max(source.height >> level, 1)) / source.height;
+    return variant.texture;
+}
+
+void TextureManager::requestVariant(SDL_Texture* texture, VariantSet& set, int level) {
+    Variant& variant = set.levels[level];
+    if (variant.isPending) {
+        return;
+    }
+    variant.isPending = true;
+
+    if (!variantJobs_) {
+        addVariant(buildVariant(*set.source, texture, level, variantFilter_));
+        return;
+    }
+
+    // 작업은 TextureManager가 아니라 큐와 원본 픽셀의 shared_ptr만 잡으므로 매니저가 먼저 파괴돼도 안전함
+    std::shared_ptr<VariantQueue> queue = variantQueue_;
+    std::shared_ptr<const SourceImage> source = set.source;
+    const ScaleFilter filter = variantFilter_;
+    variantJobs_->submit([queue, source, texture, level, filter]() {
+        BuiltVariant built = buildVariant(*source, texture, level, filter);
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->built.push_back(std::move(built));
+        queue->readyCount.fetch_add(1, std::memory_order_release);
+    });
+}
+
+void TextureManager::uploadReadyVariants() {
+    std::vector<BuiltVariant> built;
+    {
+        std::lock_guard<std::mutex> lock(variantQueue_->mutex);
+        built.swap(variantQueue_->built);
+        variantQueue_->readyCount.store(0, std::memory_order_relaxed);
+    }
+    for (const BuiltVariant& variant : built) {
+        addVariant(variant);
+    }
+}
+
+void TextureManager::addVariant(const BuiltVariant& built) {
+    auto it = variantSets_.find(built.source);
+    if (it == variantSets_.end()) {
+        return;
+    }
+    Variant& variant = it->second.levels[built.level];
+    variant.isPending = false;
+
+    const size_t bytes = built.pixels.size() * sizeof(uint32_t);
+    evictVariants(bytes);
+
+    SDL_Texture* texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, built.width, built.height);
+    if (!texture || !SDL_UpdateTexture(texture, nullptr, built.pixels.data(), built.width * static_cast<int>(sizeof(uint32_t)))) {
+        SDL_Log("TextureManager::addVariant - Failed to create scaled texture: %s", SDL_GetError());
+        if (texture) {
+            SDL_DestroyTexture(texture);
+        }
+        return;
+    }
+
+    SDL_ScaleMode scaleMode = SDL_SCALEMODE_LINEAR;
+    SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
+    SDL_GetTextureScaleMode(built.source, &scaleMode);
+    SDL_GetTextureBlendMode(built.source, &blendMode);
+    SDL_SetTextureScaleMode(texture, scaleMode);
+    SDL_SetTextureBlendMode(texture, blendMode);
+
+    variant.texture = texture;
+    variant.bytes = bytes;
+    variant.lastUsed = ++variantUseTick_;
+    variantMemory_ += bytes;
+}
+
+/*
+ * 새 축소본이 들어갈 자리가 생길 때까지 가장 오래 쓰지 않은 축소본을 캐시에서 뺌.
+ * 녹화 중에 불릴 수 있으므로 텍스처는 바로 파괴하지 않고 releaseRetiredVariants까지 미룸.
+ */
+void TextureManager::evictVariants(size_t incomingBytes) {
+    while (variantMemory_ > 0 && variantMemory_ + incomingBytes > variantBudget_) {
+        Variant* oldest = nullptr;
+        for (auto& [texture, set] : variantSets_) {
+            for (Variant& variant : set.levels) {
+                if (variant.texture && (!oldest || variant.lastUsed < oldest->lastUsed)) {
+                    oldest = &variant;
+                }
+            }
+        }
+        if (!oldest) {
+            return;
+        }
+        retiredVariants_.push_back(oldest->texture);
+        variantMemory_ -= oldest->bytes;
+        *oldest = Variant{};
+    }
+}
+
+std::string TextureManager::getTextureKey(SDL_Texture* texture) const {
+    if (!texture) {
+        return {};
+    }
+    for (const auto& [key, loaded] : textureMap_) {
+        if (loaded && loaded->sdlTexture_ == texture) {
+            return key.string();
+        }
+    }
+    for (const auto& [source, set] : variantSets_) {
+        for (int level = 1; level <= MAX_VARIANT_LEVEL; ++level) {
+            if (set.levels[level].texture == texture) {
+                const std::string sourceKey = getTextureKey(source);
+                return sourceKey.empty() ? sourceKey : sourceKey + "#" + std::to_string(level);
+            }
+        }
+    }
+    return {};
+}
+
+void TextureManager::releaseRetiredVariants() {
+    for (SDL_Texture* texture : retiredVariants_) {
+        SDL_DestroyTexture(texture);
+    }
+    retiredVariants_.clear();
+}
+
+/*
+ * @brief 원본을 1/2^level 크기로 줄임. 원본이 프리멀티플라이드 알파이므로 채널별 단순 평균으로 투명 픽셀의 색이 번지지 않음.
+ *        작업 스레드에서 실행되므로 SDL 렌더 함수를 부르지 않음.
+ */
+TextureManager::BuiltVariant TextureManager::buildVariant(const SourceImage& source, SDL_Texture* texture, int level, ScaleFilter filter) {
+    BuiltVariant built;
+    built.source = texture;
+    built.level = level;
+    built.width = std::max(source.width >> level, 1);
+    built.height = std::max(source.height >> level, 1);
+    built.pixels.resize(static_cast<size_t>(built.width) * built.height);
+
+    const int block = 1 << level;
+    for (int y = 0; y < built.height; ++y) {
+        const int blockY0 = std::min(y * block, source.height - 1);
+        const int blockY1 = std::min(blockY0 + block, source.height);
+        for (int x = 0; x < built.width; ++x) {
+            const int blockX0 = std::min(x * block, source.width - 1);
+            const int blockX1 = std::min(blockX0 + block, source.width);
+
+            int sampleX0 = blockX0, sampleX1 = blockX1, sampleY0 = blockY0, sampleY1 = blockY1;
+            if (filter == ScaleFilter::BILINEAR && block > 2) {
+                // 블록 중심의 2x2 픽셀만 평균냄
+                sampleX0 = std::min(blockX0 + block / 2 - 1, source.width - 1);
+                sampleY0 = std::min(blockY0 + block / 2 - 1, source.height - 1);
+                sampleX1 = std::min(sampleX0 + 2, source.width);
+                sampleY1 = std::min(sampleY0 + 2, source.height);
+            }
+
+            uint32_t sums[4] = {0, 0, 0, 0};
+            uint32_t count = 0;
+            for (int sy = sampleY0; sy < sampleY1; ++sy) {
+                const uint32_t* row = source.pixels.data() + static_cast<size_t>(sy) * source.width;
+                for (int sx = sampleX0; sx < sampleX1; ++sx) {
+                    for (int channel = 0; channel < 4; ++channel) {
+                        sums[channel] += (row[sx] >> (channel * 8)) & 0xFF;
+                    }
+                    ++count;
+                }
+            }
+
+            uint32_t result = 0;
+            for (int channel = 0; channel < 4; ++channel) {
+                result |= ((sums[channel] + count / 2) / count) << (channel * 8);
+            }
+            built.pixels[static_cast<size_t>(y) * built.width + x] = result;
+        }
+    }
+    return built;
+}
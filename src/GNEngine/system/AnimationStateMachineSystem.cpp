@@ -0,0 +1,131 @@
+#include "GNEngine/system/AnimationStateMachineSystem.h"
+
+#include <cmath>
+
+void AnimationStateMachineSystem::update(EntityManager& entityManager, float deltaTime) {
+    auto machineArray = entityManager.getComponentArray<AnimationStateMachineComponent>();
+    if (!machineArray) {
+        return;
+    }
+    auto animArray = entityManager.getComponentArray<AnimationComponent>();
+    auto velocityArray = entityManager.getComponentArray<VelocityComponent>();
+    auto accelerationArray = entityManager.getComponentArray<AccelerationComponent>();
+
+    const AnimationStateMachine* const* machines = machineArray->machines.data();
+    uint16_t* currentStates = machineArray->currentStates.data();
+    float* stateTimes = machineArray->stateTimes.data();
+    uint32_t* events = machineArray->events.data();
+    uint8_t* areApplied = machineArray->areApplied.data();
+
+    transitioned_.clear();
+    const size_t count = machineArray->machines.size();
+    for (size_t i = 0; i < count; ++i) {
+        const AnimationStateMachine* machine = machines[i];
+        if (!machine || machine->getStateCount() == 0) {
+            continue;
+        }
+
+        if (machine->hasBoundParameters()) {
+            fillBoundParameters(velocityArray, accelerationArray, *machineArray, i);
+        }
+
+        // FINISHED 조건을 쓰는 머신만 AnimationComponent를 찾아봄
+        bool isFinished = false;
+        if (machine->usesFinished() && animArray) {
+            auto it = animArray->getEntityToIndexMap().find(machineArray->getEntity(i));
+            isFinished = it != animArray->getEntityToIndexMap().end() && animArray->areFinished[it->second];
+        }
+
+        const uint16_t state = currentStates[i];
+        const float stateTime = stateTimes[i] + deltaTime;
+        const float* parameters = &machineArray->parameters[i * ComponentArray<AnimationStateMachineComponent>::PARAMETER_STRIDE];
+        const uint16_t next = machine->evaluate(state, parameters, events[i], stateTime, isFinished);
+        events[i] = 0;
+
+        if (next != state || !areApplied[i]) {
+            currentStates[i] = next;
+            stateTimes[i] = 0.0f;
+            areApplied[i] = true;
+            transitioned_.push_back(i);
+        } else {
+            stateTimes[i] = stateTime;
+        }
+    }
+
+    if (transitioned_.empty()) {
+        return;
+    }
+
+    auto renderArray = entityManager.getComponentArray<RenderComponent>();
+    for (size_t i : transitioned_) {
+        applyState(animArray, renderArray, machineArray->getEntity(i), machines[i]->getState(currentStates[i]));
+    }
+}
+
+void AnimationStateMachineSystem::fillBoundParameters(ComponentArray<VelocityComponent>* velocityArray, ComponentArray<AccelerationComponent>* accelerationArray,
+                                                      ComponentArray<AnimationStateMachineComponent>& machineArray, size_t index) {
+    const EntityID entity = machineArray.getEntity(index);
+
+    float vx = 0.0f, vy = 0.0f, ax = 0.0f, ay = 0.0f;
+    if (velocityArray) {
+        auto it = velocityArray->getEntityToIndexMap().find(entity);
+        if (it != velocityArray->getEntityToIndexMap().end()) {
+            vx = velocityArray->vx[it->second];
+            vy = velocityArray->vy[it->second];
+        }
+    }
+    if (accelerationArray) {
+        auto it = accelerationArray->getEntityToIndexMap().find(entity);
+        if (it != accelerationArray->getEntityToIndexMap().end()) {
+            ax = accelerationArray->ax[it->second];
+            ay = accelerationArray->ay[it->second];
+        }
+    }
+
+    float* parameters = &machineArray.parameters[index * ComponentArray<AnimationStateMachineComponent>::PARAMETER_STRIDE];
+    const auto& definitions = machineArray.machines[index]->getParameters();
+    for (size_t p = 0; p < definitions.size(); ++p) {
+        switch (definitions[p].source) {
+            case AnimationStateMachine::ParameterSource::NONE: break;
+            case AnimationStateMachine::ParameterSource::SPEED: parameters[p] = std::sqrt(vx * vx + vy * vy); break;
+            case AnimationStateMachine::ParameterSource::VELOCITY_X: parameters[p] = vx; break;
+            case AnimationStateMachine::ParameterSource::VELOCITY_Y: parameters[p] = vy; break;
+            case AnimationStateMachine::ParameterSource::ABS_VELOCITY_X: parameters[p] = std::abs(vx); break;
+            case AnimationStateMachine::ParameterSource::ACCELERATION_X: parameters[p] = ax; break;
+            case AnimationStateMachine::ParameterSource::ACCELERATION_Y: parameters[p] = ay; break;
+        }
+    }
+}
+
+void AnimationStateMachineSystem::applyState(ComponentArray<AnimationComponent>* animArray, ComponentArray<RenderComponent>* renderArray, EntityID entity, const AnimationStateMachine::State& state) {
+    if (!AnimationTable::instance().isValid(state.clip)) {
+        return;
+    }
+
+    if (animArray) {
+        auto it = animArray->getEntityToIndexMap().find(entity);
+        if (it != animArray->getEntityToIndexMap().end()) {
+            const size_t i = it->second;
+            animArray->setAnimation(i, state.clip);
+            animArray->currentFrames[i] = 0;
+            animArray->frameTimers[i] = 0.0f;
+            animArray->arePlaying[i] = true;
+            animArray->areFinished[i] = false;
+        }
+    }
+
+    if (renderArray) {
+        auto it = renderArray->getEntityToIndexMap().find(entity);
+        if (it != renderArray->getEntityToIndexMap().end()) {
+            const size_t i = it->second;
+            if (state.texture) {
+                renderArray->sdlTextures[i] = state.texture;
+            }
+            renderArray->srcRectX[i] = state.firstFrame.x;
+            renderArray->srcRectY[i] = state.firstFrame.y;
+            renderArray->srcRectW[i] = state.firstFrame.w;
+            renderArray->srcRectH[i] = state.firstFrame.h;
+            renderArray->hasAnimations[i] = true;
+        }
+    }
+}
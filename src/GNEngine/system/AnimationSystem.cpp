@@ -2,47 +2,56 @@
 #include <iostream>
 
 void AnimationSystem::update(EntityManager& entityManager, float deltaTime) {
+    events_.clear();
+    ++eventFrame_;
+
     auto animArray = entityManager.getComponentArray<AnimationComponent>();
     if (!animArray) {
         // std::cerr << "[ERROR] AnimationSystem - ComponentArray<AnimationComponent> is nullptr \n";
         return;
     }
 
-    auto& animations = animArray->animations;    
-    auto& currentFrames = animArray->currentFrames;
-    auto& frameTimers = animArray->frameTimers;
-    auto& arePlaying = animArray->arePlaying;
-    auto& areFinished = animArray->areFinished;
-
-    auto entities = entityManager.getEntitiesWith<AnimationComponent>();
-    const auto& entityToIndexMap = animArray->getEntityToIndexMap();
-
-    for (const auto& entity : entities) {
-        const size_t i = entityToIndexMap.at(entity);
-
-        if (!arePlaying[i] || !animations[i] || animations[i]->getFrameCount() == 0) {
+    const float* frameDurations = AnimationTable::instance().getFrameDurations().data();
+    const uint32_t* firstFrames = animArray->firstFrames.data();
+    const uint32_t* frameCounts = animArray->frameCounts.data();
+    const uint8_t* areLooping = animArray->areLooping.data();
+    const uint8_t* hasEvents = animArray->hasEvents.data();
+    const AnimationLod* lodLevels = animArray->lodLevels.data();
+    int* currentFrames = animArray->currentFrames.data();
+    float* frameTimers = animArray->frameTimers.data();
+    float* pendingTimes = animArray->pendingTimes.data();
+    const uint8_t* arePlaying = animArray->arePlaying.data();
+
+    // SoA 컬럼은 빈틈없이 채워져 있으므로 엔티티 목록과 인덱스 맵을 거치지 않고 순서대로 돎
+    const size_t count = animArray->handles.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (!arePlaying[i] || frameCounts[i] == 0) {
             continue;
         }
 
-        frameTimers[i] += deltaTime;
-
-        float currentFrameDuration = static_cast<float>(animations[i]->getFrameDuration(currentFrames[i])) / 1000.0f;
-
-        if (frameTimers[i] >= currentFrameDuration) {
-            frameTimers[i] -= currentFrameDuration;
-            currentFrames[i]++;
-
-            if (currentFrames[i] >= animations[i]->getFrameCount()) {
-                if (animations[i]->isLooping()) {
-                    currentFrames[i] = 0;
-                } else {
-                    currentFrames[i] = animations[i]->getFrameCount() - 1;
-                    arePlaying[i] = false;
-                    areFinished[i] = true;
-                }
+        float elapsed = deltaTime;
+        if (lodLevels[i] != AnimationLod::FULL) {
+            // 숨은 반복 클립과 이번 차례가 아닌 REDUCED 엔티티는 시간만 쌓아 둠.
+            // 반복하지 않는 클립은 끝났는지를, 이벤트가 있는 클립은 이벤트를 게임 로직이 보므로 숨어 있어도 진행함
+            const bool isSkipped = lodLevels[i] == AnimationLod::HIDDEN
+                ? areLooping[i] && !hasEvents[i]
+                : (eventFrame_ + i) % static_cast<uint64_t>(reducedUpdateInterval_) != 0;
+            if (isSkipped) {
+                pendingTimes[i] += deltaTime;
+                continue;
             }
         }
+        // 쌓아 둔 시간은 LOD와 상관없이 진행할 때 한꺼번에 반영함. REDUCED에서 FULL로 올라온 프레임에도 잃지 않음
+        if (pendingTimes[i] != 0.0f) {
+            elapsed += pendingTimes[i];
+            pendingTimes[i] = 0.0f;
+        }
+
+        const float timer = frameTimers[i] + elapsed;
+        if (timer < frameDurations[firstFrames[i] + currentFrames[i]]) {
+            frameTimers[i] = timer;
+            continue;
+        }
+        animArray->advance(i, elapsed, &events_);
     }
 }
-
-
@@ -24,6 +24,10 @@ void CameraSystem::update(EntityManager& entityManager, float deltaTime) {
     auto& transformX = transformArray->positionX;
     auto& transformY = transformArray->positionY;
 
+    // 렌더 순서가 가장 앞선 카메라를 주 카메라로 삼음. RenderSystem의 카메라 정렬(stable)과 같은 기준임
+    bool hasPrimary = false;
+    size_t primaryIndex = 0;
+
     for (EntityID entity : entityManager.getEntitiesWith<CameraComponent>()) {
         const size_t cameraIndex = cameraArray->getEntityToIndexMap().at(entity);
         // SDL_Log("CameraSystem: entity=%u, cameraIndex=%zu", entity, cameraIndex);
@@ -39,10 +43,6 @@ void CameraSystem::update(EntityManager& entityManager, float deltaTime) {
                 // 카메라를 타겟 엔티티의 위치로 이동 (간단한 따라가기 로직)
                 cameraX[cameraIndex] = transformX[targetTransformIndex];
                 cameraY[cameraIndex] = transformY[targetTransformIndex];
-
-                // RenderManager에 카메라 위치 업데이트
-                renderManager_.setCameraPosition(cameraX[cameraIndex], cameraY[cameraIndex]);
-                renderManager_.setZoomLevel(cameraZoom[cameraIndex]);
                 // SDL_Log("CameraSystem: Camera position set to (%.2f, %.2f) and zoom set to %.2f for target entity %u at (%.2f, %.2f).", cameraX[cameraIndex], cameraY[cameraIndex], cameraZoom[cameraIndex], targetId, transformX[targetTransformIndex], transformY[targetTransformIndex]);
 
                 // TODO: 부드러운 카메라 이동, 경계 처리, 줌 레벨 조정 등 추가 로직 구현
@@ -54,6 +54,17 @@ void CameraSystem::update(EntityManager& entityManager, float deltaTime) {
         }
         
         // TODO: 줌 레벨 조정 로직 등 추가
+
+        if (!hasPrimary || cameraArray->renderOrders[cameraIndex] < cameraArray->renderOrders[primaryIndex]) {
+            hasPrimary = true;
+            primaryIndex = cameraIndex;
+        }
+    }
+
+    // RenderManager의 전역 카메라는 주 카메라만 반영함. 나머지 카메라는 RenderSystem이 패스마다 뷰를 바꿔 그림
+    if (hasPrimary) {
+        renderManager_.setCameraPosition(cameraX[primaryIndex], cameraY[primaryIndex]);
+        renderManager_.setZoomLevel(cameraZoom[primaryIndex]);
     }
 }
 
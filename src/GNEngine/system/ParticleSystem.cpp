@@ -0,0 +1,163 @@
+#include "GNEngine/system/ParticleSystem.h"
+#include "GNEngine/manager/TextureManager.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <SDL3/SDL_render.h>
+
+ParticleSystem::ParticleSystem(RenderManager& renderManager)
+    : renderManager_(renderManager) {
+    layerBudgets_.fill(std::numeric_limits<size_t>::max());
+    layerEmissionScales_.fill(1.0f);
+}
+
+/* xorshift32. 파티클 방출용이라 품질보다 속도를 우선함. */
+float ParticleSystem::randomFloat() {
+    randomState_ ^= randomState_ << 13;
+    randomState_ ^= randomState_ >> 17;
+    randomState_ ^= randomState_ << 5;
+    return (randomState_ >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::emit(ParticleEmitterComponent& emitter, float x, float y, int count) {
+    constexpr float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+    auto& pool = emitter.getPool();
+
+    for (int n = 0; n < count; ++n) {
+        const float angle = (emitter.direction + (randomFloat() - 0.5f) * emitter.spread) * DEG_TO_RAD;
+        const float speed = emitter.minSpeed + (emitter.maxSpeed - emitter.minSpeed) * randomFloat();
+        const float lifetime = emitter.minLifetime + (emitter.maxLifetime - emitter.minLifetime) * randomFloat();
+        if (!pool.spawn(x, y, std::cos(angle) * speed, std::sin(angle) * speed, lifetime)) {
+            break;
+        }
+    }
+}
+
+void ParticleSystem::update(EntityManager& entityManager, float deltaTime) {
+    auto emitterArray = entityManager.getComponentArray<ParticleEmitterComponent>();
+    auto transformArray = entityManager.getComponentArray<TransformComponent>();
+    if (!emitterArray || !transformArray) {
+        return;
+    }
+
+    const auto entities = entityManager.getEntitiesWith<ParticleEmitterComponent, TransformComponent>();
+    const auto& transformIndexMap = transformArray->getEntityToIndexMap();
+
+    // 1. 레이어별 현재 파티클 수 집계 (예산 계산용)
+    layerCounts_.fill(0);
+    for (EntityID entity : entities) {
+        auto& emitter = emitterArray->getComponent(entity);
+        layerCounts_[static_cast<size_t>(emitter.getLayer())] += emitter.getPool().size();
+    }
+
+    bool isChanged = entities.size() != lastEmitterCount_; // 이미터가 제거되면 그 파티클도 사라짐
+    lastEmitterCount_ = entities.size();
+    for (EntityID entity : entities) {
+        auto& emitter = emitterArray->getComponent(entity);
+        auto& pool = emitter.getPool();
+        const size_t layer = static_cast<size_t>(emitter.getLayer());
+        const float emissionScale = layerEmissionScales_[layer];
+
+        // 2. 방출. 이미터 용량과 레이어 예산을 넘지 않게 자름
+        int toEmit = static_cast<int>(emitter.pendingBurst * emissionScale);
+        emitter.pendingBurst = 0;
+        if (emitter.isEmitting) {
+            emitter.emissionAccumulator += emitter.emissionRate * emissionScale * deltaTime;
+            const int fromRate = static_cast<int>(emitter.emissionAccumulator);
+            emitter.emissionAccumulator -= fromRate;
+            toEmit += fromRate;
+        }
+
+        const size_t budgetLeft = layerBudgets_[layer] > layerCounts_[layer] ? layerBudgets_[layer] - layerCounts_[layer] : 0;
+        toEmit = static_cast<int>(std::min({static_cast<size_t>(std::max(toEmit, 0)), pool.freeSlots(), budgetLeft}));
+        if (toEmit > 0) {
+            const size_t t = transformIndexMap.at(entity);
+            emit(emitter, transformArray->positionX[t] + emitter.offsetX, transformArray->positionY[t] + emitter.offsetY, toEmit);
+        }
+
+        // 3. 시뮬레이션
+        if (pool.size() == 0) {
+            continue;
+        }
+        const size_t before = pool.size();
+        isChanged = true;
+
+        ParticleUpdateParams params;
+        params.deltaTime = deltaTime;
+        params.gravityX = emitter.gravityX;
+        params.gravityY = emitter.gravityY;
+        params.startSize = emitter.startSize;
+        params.endSize = emitter.endSize;
+        params.startColor[0] = emitter.startColor.r; params.startColor[1] = emitter.startColor.g;
+        params.startColor[2] = emitter.startColor.b; params.startColor[3] = emitter.startColor.a;
+        params.endColor[0] = emitter.endColor.r; params.endColor[1] = emitter.endColor.g;
+        params.endColor[2] = emitter.endColor.b; params.endColor[3] = emitter.endColor.a;
+        pool.simulate(params);
+
+        layerCounts_[layer] = layerCounts_[layer] + pool.size() - before;
+    }
+
+    if (isChanged) {
+        ++revision_;
+    }
+}
+
+/*
+ * @brief 이미터마다 파티클을 중심 기준 정사각형 쿼드로 펼쳐 스프라이트 배치로 그림.
+ *        배치를 거치므로 래스터라이저가 켜져 있으면 스프라이트와 같은 프레임 버퍼에 레이어 순서대로 그려짐.
+ */
+void ParticleSystem::renderLayer(EntityManager& entityManager, RenderLayer layer) {
+    auto emitterArray = entityManager.getComponentArray<ParticleEmitterComponent>();
+    if (!emitterArray) {
+        return;
+    }
+
+    const float zoom = renderManager_.getZoomLevel();
+    const float cameraX = renderManager_.getCameraX();
+    const float cameraY = renderManager_.getCameraY();
+    const float halfScreenW = renderManager_.getViewWidth() / 2.0f;
+    const float halfScreenH = renderManager_.getViewHeight() / 2.0f;
+
+    for (EntityID entity : entityManager.getEntitiesWith<ParticleEmitterComponent>()) {
+        auto& emitter = emitterArray->getComponent(entity);
+        const auto& pool = emitter.getPool();
+        const size_t count = pool.size();
+        if (emitter.getLayer() != layer || count == 0) {
+            continue;
+        }
+
+        float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+        if (emitter.getTexture() && emitter.getTextureWidth() > 0.0f && emitter.getTextureHeight() > 0.0f) {
+            u0 = emitter.srcRect.x / emitter.getTextureWidth();
+            v0 = emitter.srcRect.y / emitter.getTextureHeight();
+            u1 = (emitter.srcRect.x + emitter.srcRect.w) / emitter.getTextureWidth();
+            v1 = (emitter.srcRect.y + emitter.srcRect.h) / emitter.getTextureHeight();
+        }
+
+        // TextureManager가 불러온 텍스처는 프리멀티플라이드 알파이므로 블렌드 모드도 그에 맞춤. 정점 색의 알파는 배치가 곱함
+        SDL_BlendMode blendMode = emitter.blendMode;
+        const bool isPremultiplied = TextureManager::isPremultiplied(emitter.getTexture());
+        if (isPremultiplied) {
+            if (blendMode == SDL_BLENDMODE_BLEND) blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+            else if (blendMode == SDL_BLENDMODE_ADD) blendMode = SDL_BLENDMODE_ADD_PREMULTIPLIED;
+        }
+
+        vertices_.resize(count * 4);
+        SDL_Vertex* vertex = vertices_.data();
+        for (size_t i = 0; i < count; ++i, vertex += 4) {
+            const float screenX = (pool.posX[i] - cameraX) * zoom + halfScreenW;
+            const float screenY = (pool.posY[i] - cameraY) * zoom + halfScreenH;
+            const float half = pool.sizes[i] * zoom * 0.5f;
+            const SDL_FColor color = {pool.colorR[i], pool.colorG[i], pool.colorB[i], pool.colorA[i]};
+
+            vertex[0] = {{screenX - half, screenY - half}, color, {u0, v0}};
+            vertex[1] = {{screenX + half, screenY - half}, color, {u1, v0}};
+            vertex[2] = {{screenX + half, screenY + half}, color, {u1, v1}};
+            vertex[3] = {{screenX - half, screenY + half}, color, {u0, v1}};
+        }
+
+        // 블렌드 모드는 RenderManager가 이 쿼드를 그리는 동안만 바꿨다가 되돌림
+        renderManager_.drawQuads(emitter.getTexture(), vertices_.data(), count, blendMode);
+    }
+}
@@ -2,104 +2,932 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <SDL3/SDL_render.h>
 
 #include "GNEngine/core/Entity.h"
 #include "GNEngine/core/RenderLayer.h"
 #include "GNEngine/component/FadeComponent.h"
+#include "GNEngine/core/FastMath.h"
+#include "GNEngine/manager/TextureManager.h"
+
+namespace {
+    /* 정적 레이어 변경 감지용 해시 결합 */
+    inline void hashCombine(uint64_t& seed, uint64_t value) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    }
+
+    inline uint64_t floatBits(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline int64_t tileKey(int tileX, int tileY) {
+        return (static_cast<int64_t>(tileX) << 32) | static_cast<uint32_t>(tileY);
+    }
+}
 
 RenderSystem::RenderSystem(RenderManager& renderManager)
     : renderManager_(renderManager) {}
 
+RenderSystem::~RenderSystem() {
+    for (auto& cache : staticLayers_) {
+        releaseTiles(cache);
+    }
+    for (SDL_Texture* texture : retiredTiles_) {
+        SDL_DestroyTexture(texture);
+    }
+}
+
+void RenderSystem::setLayerStatic(RenderLayer layer, bool isStatic) {
+    auto& cache = staticLayers_[static_cast<size_t>(layer)];
+    if (cache.isStatic == isStatic) {
+        return;
+    }
+    cache.isStatic = isStatic;
+    cache.isDirty = true;
+    cache.sprites.clear();
+    releaseTiles(cache);
+}
+
+bool RenderSystem::isLayerStatic(RenderLayer layer) const {
+    return staticLayers_[static_cast<size_t>(layer)].isStatic;
+}
+
+void RenderSystem::setLayerSort(RenderLayer layer, LayerSortMode mode, int resortInterval) {
+    auto& state = layerSorts_[static_cast<size_t>(layer)];
+    state.mode = mode;
+    state.resortInterval = std::max(resortInterval, 1);
+    state.framesSinceSort = state.resortInterval; // 다음 프레임에 바로 정렬
+    state.entries.clear();
+}
+
+RenderSystem::LayerSortMode RenderSystem::getLayerSortMode(RenderLayer layer) const {
+    return layerSorts_[static_cast<size_t>(layer)].mode;
+}
+
+void RenderSystem::markLayerDirty(RenderLayer layer) {
+    staticLayers_[static_cast<size_t>(layer)].isDirty = true;
+}
+
+/* 캐시에서 타일을 모두 뺌. 같은 프레임에 이미 기록된 블릿이 있을 수 있으므로 텍스처는 trimStaticTiles에서 파괴함. */
+void RenderSystem::releaseTiles(StaticLayerCache& cache) {
+    for (auto& [key, tile] : cache.tiles) {
+        if (tile.texture) {
+            retiredTiles_.push_back(tile.texture);
+        }
+    }
+    cache.tiles.clear();
+}
+
+/*
+ * @brief 기록한 명령을 실행한 뒤 프레임당 한 번 호출함. 내보낸 타일을 파괴하고,
+ *        캐시가 너무 커진 레이어에서는 이번 프레임에 어느 카메라도 블릿하지 않은 타일을 해제함.
+ */
+void RenderSystem::trimStaticTiles() {
+    for (SDL_Texture* texture : retiredTiles_) {
+        SDL_DestroyTexture(texture);
+    }
+    retiredTiles_.clear();
+
+    for (auto& cache : staticLayers_) {
+        if (cache.tiles.size() <= MAX_CACHED_TILES_PER_LAYER) {
+            continue;
+        }
+        for (auto it = cache.tiles.begin(); it != cache.tiles.end();) {
+            if (it->second.lastUsedFrame != renderFrame_) {
+                if (it->second.texture) {
+                    SDL_DestroyTexture(it->second.texture);
+                }
+                it = cache.tiles.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
 
 /*
  * TransformComponent와 RenderComponent를 가진 엔티티를 렌더링 계층 순서대로 렌더링함. 
+ * 엔티티를 레이어별 버킷에 모아 드로우 아이템과 카메라별 가시성을 한 번 계산한 뒤, 카메라마다 자기 뷰포트에 그림.
+ * 정적 레이어는 캐시된 타일로 대신 그림.
 */
 void RenderSystem::update(EntityManager& entityManager, float deltaTime) {
-    // 이 함수 내에서만 사용할 로컬 구조체
-    struct Renderable {
-        EntityID entity;
-        RenderLayer layer;
-    };
-
-    // 정렬용 람다
-    auto compareRenderables = [](const Renderable& a, const Renderable& b) {
-        return static_cast<int>(a.layer) < static_cast<int>(b.layer);
-    };
-
-    std::vector<Renderable> renderables;
+    for (auto& bucket : layerBuckets_) {
+        bucket.clear();
+    }
 
-    // 1. RenderComponent가 있는 엔티티 수집
+    // 1. RenderComponent가 있는 엔티티를 레이어별로 수집
     auto renderArray = entityManager.getComponentArray<RenderComponent>();
     if (renderArray) {
+        const auto& renderIndexMap = renderArray->getEntityToIndexMap();
         for (const auto& entity : entityManager.getEntitiesWith<RenderComponent, TransformComponent>()) {
-            const auto& renderComponent = renderArray->getComponent(entity);
-            renderables.push_back({entity, renderComponent.getLayer()});
+            const size_t index = renderIndexMap.at(entity);
+            layerBuckets_[static_cast<size_t>(renderArray->layers[index])].push_back(entity);
+        }
+    }
+
+    for (size_t layer = 0; layer < layerBuckets_.size(); ++layer) {
+        if (layerSorts_[layer].mode != LayerSortMode::NONE) {
+            sortLayer(entityManager, layerSorts_[layer], layerBuckets_[layer]);
         }
     }
 
-    // 2. 레이어 기준으로 모든 렌더링 대상 정렬
-    std::sort(renderables.begin(), renderables.end(), compareRenderables);
+    // 2. 카메라 수집. 정적 레이어 캐시는 줌 하나에 대해서만 유효하므로 카메라 줌이 서로 다르면 이번 프레임에는 쓰지 않음.
+    //    CPU 래스터라이저는 렌더 타겟 텍스처에 그릴 수 없으므로 그때도 쓰지 않음
+    collectCameras(entityManager);
+    if (cameras_.empty()) {
+        renderManager_.clear();
+        return;
+    }
+    const float staticZoom = cameras_.front().zoom;
+    const bool canUseStaticCache = !renderManager_.getRasterizer() && std::all_of(cameras_.begin(), cameras_.end(),
+                                               [staticZoom](const CameraView& camera) { return camera.zoom == staticZoom; });
+
+    // 3. 레이어별 드로우 아이템과 정적 캐시를 프레임당 한 번 준비
+    for (size_t layer = 0; layer < layerBuckets_.size(); ++layer) {
+        auto& items = layerItems_[layer];
+        items.clear();
+        isStaticLayerReady_[layer] = false;
+        if (layerBuckets_[layer].empty()) {
+            continue;
+        }
 
-    // 3. 정렬된 순서대로 렌더링
+        uint64_t staticSignature = 0;
+        buildDrawItems(entityManager, layerBuckets_[layer], items, staticSignature);
+
+        auto& cache = staticLayers_[layer];
+        if (cache.isStatic && canUseStaticCache) {
+            isStaticLayerReady_[layer] = prepareStaticLayer(entityManager, cache, layerBuckets_[layer], staticSignature, staticZoom);
+        }
+    }
+
+    // 4. 보이는 내용이 지난 프레임과 같으면 clear/렌더 패스/present를 건너뜀
+    if (isPresentSkipping_) {
+        uint64_t signature = 0;
+        const bool isComparable = computeFrameSignature(entityManager, signature);
+        if (isComparable && hasLastFrame_ && signature == lastFrameSignature_ && skippedFrames_ < MAX_SKIPPED_FRAMES) {
+            ++skippedFrames_;
+            renderManager_.skipPresent();
+            return;
+        }
+        lastFrameSignature_ = signature;
+        hasLastFrame_ = isComparable;
+        skippedFrames_ = 0;
+    }
+    renderManager_.clear();
+    commandList_.clear();
+    ++renderFrame_;
+    renderManager_.beginRecording(&commandList_);
+
+    // 5. 회전 sin/cos과 모든 카메라에 대한 가시성을 한 번에 계산
+    computeRotations();
+    computeVisibility();
+    updateAnimationLod(entityManager);
+
+    // 6. 카메라 순서대로 패스 실행
+    for (size_t c = 0; c < cameras_.size(); ++c) {
+        const CameraView& camera = cameras_[c];
+        if (camera.usesViewport) {
+            renderManager_.beginCameraView(camera.viewport, camera.x, camera.y, camera.zoom);
+        }
+        renderPass(entityManager, c);
+        if (camera.usesViewport) {
+            renderManager_.endCameraView();
+        }
+    }
+
+    // 7. 화면 공간 아이템(UI, 페이드 등)은 카메라 뷰포트가 창보다 작아도 잘리지 않도록 뷰포트를 되돌린 뒤 전체 화면 위에 한 번만 그림
+    for (size_t layer = 0; layer < layerItems_.size(); ++layer) {
+        commandList_.setLayer(static_cast<uint8_t>(layer));
+        for (const DrawItem& item : layerItems_[layer]) {
+            if (item.isOverlay) {
+                drawItem(item);
+            }
+        }
+    }
+
+    // 8. 기록한 명령을 실행
+    renderManager_.endRecording();
+    if (!dumpPath_.empty()) {
+        TextureManager* textureManager = renderManager_.getTextureManager();
+        commandList_.saveToFile(dumpPath_, [textureManager](SDL_Texture* texture) {
+            return textureManager ? textureManager->getTextureKey(texture) : std::string();
+        });
+        dumpPath_.clear();
+    }
+    renderManager_.execute(commandList_);
+
+    // 9. 실행이 끝났으므로 이번 프레임 명령이 가리키던 타일을 정리해도 됨
+    trimStaticTiles();
+}
+
+/*
+ * @brief 이전 프레임의 정렬 결과를 시작점으로 bucket을 정렬함.
+ *        1) 이전 순서에서 사라진 엔티티를 빼고 새 엔티티를 뒤에 붙임.
+ *        2) 정렬할 프레임이면 모든 키를 다시 읽음. 아니면 새 엔티티만 현재 키를 가짐.
+ *        3) 삽입 정렬. 이미 거의 정렬되어 있으면 O(n + 이동 수)이며, 이동이 너무 많으면 stable_sort로 마무리함.
+ */
+void RenderSystem::sortLayer(EntityManager& entityManager, LayerSortState& state, std::vector<EntityID>& bucket) {
+    auto transformArray = entityManager.getComponentArray<TransformComponent>();
+    auto renderArray = entityManager.getComponentArray<RenderComponent>();
+    if (!transformArray || !renderArray) {
+        return;
+    }
+    const auto& transformIndexMap = transformArray->getEntityToIndexMap();
+    const auto& renderIndexMap = renderArray->getEntityToIndexMap();
+
+    auto readKey = [&](EntityID entity) {
+        if (state.mode == LayerSortMode::DEPTH) {
+            return renderArray->depths[renderIndexMap.at(entity)];
+        }
+        return transformArray->positionY[transformIndexMap.at(entity)];
+    };
+
+    // 1. 버킷 소속 표시. inBucket은 이번 버킷, kept는 이전 순서에서 살아남은 엔티티
+    sortStamp_ += 2;
+    if (sortStamp_ < 2) { // 감싸 돌면 이전 표시와 섞이지 않도록 초기화
+        std::fill(entityStamps_.begin(), entityStamps_.end(), 0u);
+        sortStamp_ = 2;
+    }
+    const uint32_t inBucket = sortStamp_;
+    const uint32_t kept = sortStamp_ + 1;
+
+    for (EntityID entity : bucket) {
+        if (entity >= entityStamps_.size()) {
+            entityStamps_.resize(static_cast<size_t>(entity) + 1, 0u);
+        }
+        entityStamps_[entity] = inBucket;
+    }
+
+    auto& entries = state.entries;
+    size_t write = 0;
+    for (const SortEntry& entry : entries) {
+        if (entry.entity < entityStamps_.size() && entityStamps_[entry.entity] == inBucket) {
+            entityStamps_[entry.entity] = kept;
+            entries[write++] = entry;
+        }
+    }
+    entries.resize(write);
+    for (EntityID entity : bucket) {
+        if (entityStamps_[entity] == inBucket) {
+            entries.push_back({readKey(entity), entity});
+        }
+    }
+
+    // 2. 정렬 간격이 되었으면 키 갱신
+    if (++state.framesSinceSort >= state.resortInterval) {
+        state.framesSinceSort = 0;
+        for (SortEntry& entry : entries) {
+            entry.key = readKey(entry.entity);
+        }
+    }
+
+    // 3. 삽입 정렬 (안정 정렬이라 키가 같으면 이전 순서 유지)
+    const size_t count = entries.size();
+    const size_t maxShifts = count * 8 + 64;
+    size_t shifts = 0;
+    for (size_t i = 1; i < count; ++i) {
+        const SortEntry entry = entries[i];
+        size_t j = i;
+        while (j > 0 && entries[j - 1].key > entry.key && shifts <= maxShifts) {
+            entries[j] = entries[j - 1];
+            --j;
+            ++shifts;
+        }
+        entries[j] = entry;
+        if (shifts > maxShifts) {
+            // 순서가 크게 바뀐 프레임(순간이동, 첫 정렬 등)은 일반 정렬이 더 빠름
+            std::stable_sort(entries.begin(), entries.end(), [](const SortEntry& a, const SortEntry& b) { return a.key < b.key; });
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        bucket[i] = entries[i].entity;
+    }
+}
+
+/*
+ * @brief CameraComponent를 renderOrder 순으로 모아 뷰를 만듦.
+ *        카메라가 없으면 RenderManager의 현재 카메라 상태로 윈도우 전체를 보는 뷰 하나를 만듦.
+ */
+void RenderSystem::collectCameras(EntityManager& entityManager) {
+    cameras_.clear();
+
+    const int outputW = renderManager_.getWindowWidth();
+    const int outputH = renderManager_.getWindowHeight();
+
+    auto cameraArray = entityManager.getComponentArray<CameraComponent>();
+    if (cameraArray) {
+        const auto& cameraIndexMap = cameraArray->getEntityToIndexMap();
+        for (EntityID entity : entityManager.getEntitiesWith<CameraComponent>()) {
+            if (cameras_.size() >= MAX_CAMERAS) {
+                break;
+            }
+            const size_t i = cameraIndexMap.at(entity);
+            CameraView camera;
+            camera.viewport.x = static_cast<int>(std::lround(cameraArray->viewportX[i] * outputW));
+            camera.viewport.y = static_cast<int>(std::lround(cameraArray->viewportY[i] * outputH));
+            camera.viewport.w = static_cast<int>(std::lround(cameraArray->viewportW[i] * outputW));
+            camera.viewport.h = static_cast<int>(std::lround(cameraArray->viewportH[i] * outputH));
+            camera.x = cameraArray->x[i];
+            camera.y = cameraArray->y[i];
+            camera.zoom = cameraArray->zoom[i];
+            camera.renderOrder = cameraArray->renderOrders[i];
+            camera.usesViewport = true;
+            if (camera.viewport.w <= 0 || camera.viewport.h <= 0 || camera.zoom <= 0.0f) {
+                continue;
+            }
+            cameras_.push_back(camera);
+        }
+        std::stable_sort(cameras_.begin(), cameras_.end(),
+                         [](const CameraView& a, const CameraView& b) { return a.renderOrder < b.renderOrder; });
+    }
+
+    if (cameras_.empty()) {
+        CameraView camera;
+        camera.viewport = {0, 0, outputW, outputH};
+        camera.x = renderManager_.getCameraX();
+        camera.y = renderManager_.getCameraY();
+        camera.zoom = renderManager_.getZoomLevel();
+        camera.renderOrder = 0;
+        camera.usesViewport = false;
+        if (camera.zoom <= 0.0f) {
+            return;
+        }
+        cameras_.push_back(camera);
+    }
+
+    for (CameraView& camera : cameras_) {
+        const float halfViewW = static_cast<float>(camera.viewport.w) / 2.0f / camera.zoom;
+        const float halfViewH = static_cast<float>(camera.viewport.h) / 2.0f / camera.zoom;
+        camera.minX = camera.x - halfViewW;
+        camera.minY = camera.y - halfViewH;
+        camera.maxX = camera.x + halfViewW;
+        camera.maxY = camera.y + halfViewH;
+    }
+}
+
+/*
+ * @brief 레이어 버킷의 엔티티를 드로우 아이템으로 변환함. 컴포넌트 값은 SoA 컬럼에서 직접 읽음.
+ *        애니메이션 프레임, 최종 크기, 반전, 컬링용 AABB를 여기서 한 번만 계산함.
+ * @param outStaticSignature 정적 캐시에 구울 수 있는 아이템(isStaticCached)의 상태 해시. 같은 루프에서 계산하므로
+ *        정적 레이어는 엔티티를 다시 읽지 않고도 매 프레임 변경을 감지함.
+ */
+void RenderSystem::buildDrawItems(EntityManager& entityManager, const std::vector<EntityID>& entities, std::vector<DrawItem>& outItems, uint64_t& outStaticSignature) {
     auto transformArray = entityManager.getComponentArray<TransformComponent>();
+    auto renderArray = entityManager.getComponentArray<RenderComponent>();
     auto animArray = entityManager.getComponentArray<AnimationComponent>();
+    auto textArray = entityManager.getComponentArray<TextComponent>();
     auto fadeArray = entityManager.getComponentArray<FadeComponent>();
+    if (!transformArray || !renderArray) {
+        return;
+    }
 
-    for (const auto& renderable : renderables) {
-        EntityID entity = renderable.entity;
-
-        // TransformComponent
-        if (!transformArray->hasComponent(entity)) continue;
-        const auto& transform = transformArray->getComponent(entity);
-
-        // RenderComponent 처리
-        if (renderArray && renderArray->hasComponent(entity)) {
-            const auto& render = renderArray->getComponent(entity);
-            if (render.getSDLTexture()) {
-                SDL_Rect srcRect = render.getSrcRect();
-                float destW = static_cast<float>(render.getWidth()) * transform.scaleX_;
-                float destH = static_cast<float>(render.getHeight()) * transform.scaleY_;
-
-                if (render.hasAnimation() && animArray && animArray->hasComponent(entity)) {
-                    const auto& anim = animArray->getComponent(entity);
-                    if (anim.animation_) { // animation_이 유효한지 확인
-                        srcRect = anim.animation_->getFrame(anim.currentFrame_); // currentFrame_ 사용
-                        destW = static_cast<float>(srcRect.w) * transform.scaleX_;
-                        destH = static_cast<float>(srcRect.h) * transform.scaleY_;
-                    }
-                }
+    const auto& transformIndexMap = transformArray->getEntityToIndexMap();
+    const auto& renderIndexMap = renderArray->getEntityToIndexMap();
 
-                SDL_FlipMode flip = SDL_FLIP_NONE;
-                if (render.getFlipX()) flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_HORIZONTAL);
-                if (render.getFlipY()) flip = static_cast<SDL_FlipMode>(flip | SDL_FLIP_VERTICAL);
+    outStaticSignature = entities.size();
+    outItems.reserve(entities.size());
+    for (EntityID entity : entities) {
+        const size_t t = transformIndexMap.at(entity);
+        const size_t r = renderIndexMap.at(entity);
 
-                if (render.isScreenSpace()) {
-                    renderManager_.renderUITexture(render.getSDLTexture(), transform.positionX_, transform.positionY_, &srcRect, destW, destH, flip);
-                } else {
-                    renderManager_.renderTexture(render.getSDLTexture(), transform.positionX_, transform.positionY_, &srcRect, destW, destH, flip);
+        const bool isScreenSpace = renderArray->isScreenSpace[r];
+        const float posX = transformArray->positionX[t];
+        const float posY = transformArray->positionY[t];
+        const float scaleX = transformArray->scaleX[t];
+        const float scaleY = transformArray->scaleY[t];
+
+        DrawItem item{};
+        item.isOverlay = isScreenSpace;
+        item.x = posX;
+        item.y = posY;
+        item.cosAngle = 1.0f;
+        item.animIndex = UINT32_MAX;
+
+        // TextComponent는 글리프 아틀라스 쿼드로 그림
+        if (textArray && textArray->hasComponent(entity)) {
+            const size_t i = textArray->getEntityToIndexMap().at(entity);
+            const TextLayout& layout = textArray->layouts[i];
+            if (!layout.atlas || !layout.atlas->getTexture()) {
+                continue;
+            }
+            item.kind = DrawItem::Kind::TEXT;
+            item.texture = layout.atlas->getTexture();
+            item.layout = &layout;
+            item.color = {textArray->colorsR[i] / 255.0f, textArray->colorsG[i] / 255.0f, textArray->colorsB[i] / 255.0f, textArray->colorsA[i] / 255.0f};
+            item.w = scaleX;
+            item.h = scaleY;
+            item.halfExtentX = std::fabs(layout.width * scaleX) / 2.0f;
+            item.halfExtentY = std::fabs(layout.height * scaleY) / 2.0f;
+            outItems.push_back(item);
+            continue;
+        }
+
+        if (renderArray->sdlTextures[r]) {
+            item.kind = DrawItem::Kind::SPRITE;
+            item.texture = renderArray->sdlTextures[r];
+            item.srcRect = {renderArray->srcRectX[r], renderArray->srcRectY[r], renderArray->srcRectW[r], renderArray->srcRectH[r]};
+            item.w = static_cast<float>(renderArray->widths[r]) * scaleX;
+            item.h = static_cast<float>(renderArray->heights[r]) * scaleY;
+
+            if (renderArray->hasAnimations[r] && animArray && animArray->hasComponent(entity)) {
+                const size_t a = animArray->getEntityToIndexMap().at(entity);
+                if (animArray->frameCounts[a] > 0) {
+                    item.animIndex = static_cast<uint32_t>(a);
+                    item.srcRect = AnimationTable::instance().getFrameRect(animArray->firstFrames[a] + animArray->currentFrames[a]);
+                    item.w = static_cast<float>(item.srcRect.w) * scaleX;
+                    item.h = static_cast<float>(item.srcRect.h) * scaleY;
                 }
+            }
+
+            item.flip = SDL_FLIP_NONE;
+            if (renderArray->flipX[r]) item.flip = static_cast<SDL_FlipMode>(item.flip | SDL_FLIP_HORIZONTAL);
+            if (renderArray->flipY[r]) item.flip = static_cast<SDL_FlipMode>(item.flip | SDL_FLIP_VERTICAL);
 
-                // SDL_Log("RenderSystem::update - Rendering texture at (%.2f, %.2f) with size (%.2f, %.2f)", transform.positionX_, transform.positionY_, destW, destH);
+            item.angle = transformArray->rotatedAngle[t];
+            item.pivotX = transformArray->pivotX[t];
+            item.pivotY = transformArray->pivotY[t];
+            item.isRotated = item.angle != 0.0f || item.pivotX != 0.5f || item.pivotY != 0.5f;
+
+            item.isStaticCached = !renderArray->hasAnimations[r] && !isScreenSpace && !item.isRotated;
+            if (item.isStaticCached) {
+                hashCombine(outStaticSignature, entity);
+                hashCombine(outStaticSignature, reinterpret_cast<uintptr_t>(item.texture));
+                hashCombine(outStaticSignature, floatBits(posX));
+                hashCombine(outStaticSignature, floatBits(posY));
+                hashCombine(outStaticSignature, floatBits(scaleX));
+                hashCombine(outStaticSignature, floatBits(scaleY));
+                hashCombine(outStaticSignature, static_cast<uint64_t>(renderArray->widths[r]) << 32 | static_cast<uint32_t>(renderArray->heights[r]));
+                hashCombine(outStaticSignature, static_cast<uint64_t>(item.srcRect.x) << 32 | static_cast<uint32_t>(item.srcRect.y));
+                hashCombine(outStaticSignature, static_cast<uint64_t>(item.srcRect.w) << 32 | static_cast<uint32_t>(item.srcRect.h));
+                hashCombine(outStaticSignature, static_cast<uint64_t>(item.flip));
+            }
+            if (item.isRotated) {
+                // 기준점을 중심으로 어느 각도로 돌아도 들어가는 반지름으로 컬링함
+                const float reachX = std::max(item.pivotX, 1.0f - item.pivotX) * std::fabs(item.w);
+                const float reachY = std::max(item.pivotY, 1.0f - item.pivotY) * std::fabs(item.h);
+                item.halfExtentX = item.halfExtentY = std::sqrt(reachX * reachX + reachY * reachY);
             } else {
-                // TODO 4 - 아래 로직 삭제. imageError 이미지를 대신 렌더링하게 하기. 
-                // 임시 : 텍스처가 없는 RenderComponent는 페이드 효과로 간주 
-                if (fadeArray && fadeArray->hasComponent(entity)) {
-                    const auto& fade = fadeArray->getComponent(entity);
-                    SDL_Renderer* renderer = renderManager_.getRenderer();
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-                    SDL_SetRenderDrawColor(renderer, fade.color.r, fade.color.g, fade.color.b, static_cast<Uint8>(fade.currentAlpha));
-
-                    int w, h;
-                    SDL_GetRenderOutputSize(renderer, &w, &h);
-                    SDL_FRect fadeRect = { 0, 0, static_cast<float>(w), static_cast<float>(h) };
-
-                    SDL_RenderFillRect(renderer, &fadeRect);
-                    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+                item.halfExtentX = std::fabs(item.w) / 2.0f;
+                item.halfExtentY = std::fabs(item.h) / 2.0f;
+            }
+            outItems.push_back(item);
+            continue;
+        }
+
+        // TODO 4 - 아래 로직 삭제. imageError 이미지를 대신 렌더링하게 하기. 
+        // 임시 : 텍스처가 없는 RenderComponent는 페이드 효과로 간주 
+        if (fadeArray && fadeArray->hasComponent(entity)) {
+            const auto& fade = fadeArray->getComponent(entity);
+            item.kind = DrawItem::Kind::FILL;
+            item.isOverlay = true;
+            item.fillColor = {fade.color.r, fade.color.g, fade.color.b, static_cast<Uint8>(fade.currentAlpha)};
+            outItems.push_back(item);
+        }
+    }
+}
+
+/*
+ * @brief 화면에 그려질 내용을 하나의 해시로 요약함.
+ *        드로우 아이템에는 위치, 크기, 애니메이션 프레임(srcRect), 회전, 색, 페이드 알파, 텍스트 글리프 배치가 모두 들어 있으므로
+ *        이들과 카메라, 출력 크기, 배경색, 레이어 렌더러 리비전을 해시하면 됨.
+ * @return 리비전이 없는 레이어 렌더러가 있어 비교할 수 없으면 false.
+ */
+bool RenderSystem::computeFrameSignature(EntityManager& entityManager, uint64_t& outSignature) {
+    uint64_t signature = 0;
+
+    const SDL_Color background = renderManager_.getBackgroundColor();
+    hashCombine(signature, static_cast<uint64_t>(renderManager_.getWindowWidth()) << 32 | static_cast<uint32_t>(renderManager_.getWindowHeight()));
+    hashCombine(signature, static_cast<uint64_t>(background.r) << 24 | background.g << 16 | background.b << 8 | background.a);
+
+    for (const CameraView& camera : cameras_) {
+        hashCombine(signature, static_cast<uint64_t>(camera.viewport.x) << 32 | static_cast<uint32_t>(camera.viewport.y));
+        hashCombine(signature, static_cast<uint64_t>(camera.viewport.w) << 32 | static_cast<uint32_t>(camera.viewport.h));
+        hashCombine(signature, floatBits(camera.x) << 32 | floatBits(camera.y));
+        hashCombine(signature, floatBits(camera.zoom));
+    }
+
+    bool isComparable = true;
+    for (const auto& layerRenderer : layerRenderers_) {
+        if (!layerRenderer.revision) {
+            isComparable = false;
+            continue;
+        }
+        hashCombine(signature, layerRenderer.revision(entityManager));
+    }
+
+    for (const auto& items : layerItems_) {
+        hashCombine(signature, items.size());
+        for (const DrawItem& item : items) {
+            hashCombine(signature, static_cast<uint64_t>(item.kind) | static_cast<uint64_t>(item.flip) << 8 | static_cast<uint64_t>(item.isOverlay) << 16);
+            hashCombine(signature, reinterpret_cast<uintptr_t>(item.texture));
+            hashCombine(signature, floatBits(item.x) << 32 | floatBits(item.y));
+            hashCombine(signature, floatBits(item.w) << 32 | floatBits(item.h));
+            switch (item.kind) {
+            case DrawItem::Kind::SPRITE:
+                hashCombine(signature, static_cast<uint64_t>(item.srcRect.x) << 32 | static_cast<uint32_t>(item.srcRect.y));
+                hashCombine(signature, static_cast<uint64_t>(item.srcRect.w) << 32 | static_cast<uint32_t>(item.srcRect.h));
+                hashCombine(signature, floatBits(item.angle));
+                hashCombine(signature, floatBits(item.pivotX) << 32 | floatBits(item.pivotY));
+                break;
+            case DrawItem::Kind::TEXT:
+                hashCombine(signature, floatBits(item.color.r) << 32 | floatBits(item.color.g));
+                hashCombine(signature, floatBits(item.color.b) << 32 | floatBits(item.color.a));
+                hashCombine(signature, item.layout->quads.size());
+                for (const auto& quad : item.layout->quads) {
+                    hashCombine(signature, floatBits(quad.x) << 32 | floatBits(quad.y));
+                    hashCombine(signature, floatBits(quad.srcRect.x) << 32 | floatBits(quad.srcRect.y));
                 }
+                break;
+            case DrawItem::Kind::FILL:
+                hashCombine(signature, static_cast<uint64_t>(item.fillColor.r) << 24 | item.fillColor.g << 16 | item.fillColor.b << 8 | item.fillColor.a);
+                break;
+            }
+        }
+    }
+
+    outSignature = signature;
+    return isComparable;
+}
+
+/*
+ * @brief 회전한 아이템의 sin/cos를 모아 FastMath로 한꺼번에 계산함.
+ *        회전하지 않은 아이템은 이 단계를 건너뛰므로 비용이 들지 않음.
+ */
+void RenderSystem::computeRotations() {
+    rotatedItems_.clear();
+    rotationAngles_.clear();
+    for (auto& items : layerItems_) {
+        for (DrawItem& item : items) {
+            if (item.isRotated && item.angle != 0.0f) {
+                rotatedItems_.push_back(&item);
+                rotationAngles_.push_back(item.angle);
             }
         }
     }
+    if (rotatedItems_.empty()) {
+        return;
+    }
+
+    rotationSins_.resize(rotationAngles_.size());
+    rotationCoss_.resize(rotationAngles_.size());
+    FastMath::sinCosDegrees(rotationAngles_.data(), rotationSins_.data(), rotationCoss_.data(), rotationAngles_.size());
+    for (size_t i = 0; i < rotatedItems_.size(); ++i) {
+        rotatedItems_[i]->sinAngle = rotationSins_[i];
+        rotatedItems_[i]->cosAngle = rotationCoss_[i];
+    }
 }
 
+/*
+ * @brief 월드 공간 아이템마다 어느 카메라에 보이는지 비트마스크로 기록함.
+ *        모든 카메라 영역의 합집합 밖에 있는 아이템은 카메라별 검사 없이 바로 버림.
+ */
+void RenderSystem::computeVisibility() {
+    float unionMinX = INFINITY, unionMinY = INFINITY, unionMaxX = -INFINITY, unionMaxY = -INFINITY;
+    for (const CameraView& camera : cameras_) {
+        unionMinX = std::min(unionMinX, camera.minX);
+        unionMinY = std::min(unionMinY, camera.minY);
+        unionMaxX = std::max(unionMaxX, camera.maxX);
+        unionMaxY = std::max(unionMaxY, camera.maxY);
+    }
 
+    const size_t cameraCount = cameras_.size();
+    for (auto& items : layerItems_) {
+        for (DrawItem& item : items) {
+            if (item.isOverlay) {
+                continue;
+            }
+            const float minX = item.x - item.halfExtentX;
+            const float minY = item.y - item.halfExtentY;
+            const float maxX = item.x + item.halfExtentX;
+            const float maxY = item.y + item.halfExtentY;
+            if (maxX < unionMinX || minX > unionMaxX || maxY < unionMinY || minY > unionMaxY) {
+                continue;
+            }
+            for (size_t c = 0; c < cameraCount; ++c) {
+                const CameraView& camera = cameras_[c];
+                if (maxX >= camera.minX && minX <= camera.maxX && maxY >= camera.minY && minY <= camera.maxY) {
+                    item.cameraMask |= 1u << c;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * @brief 가시성 결과로 애니메이션 스프라이트의 AnimationLod를 정함. 이번 프레임에 다시 보이게 된 HIDDEN 엔티티는
+ *        AnimationSystem이 건너뛴 시간만큼 진행시키고 드로우 아이템의 소스 영역을 새 프레임으로 바꿈.
+ */
+void RenderSystem::updateAnimationLod(EntityManager& entityManager) {
+    auto animArray = entityManager.getComponentArray<AnimationComponent>();
+    if (!animArray) {
+        return;
+    }
+
+    float maxZoom = 0.0f;
+    for (const CameraView& camera : cameras_) {
+        maxZoom = std::max(maxZoom, camera.zoom);
+    }
+
+    const AnimationTable& table = AnimationTable::instance();
+    for (auto& items : layerItems_) {
+        for (DrawItem& item : items) {
+            if (item.animIndex == UINT32_MAX) {
+                continue;
+            }
+            const size_t a = item.animIndex;
+            if (!isAnimationCulling_) {
+                animArray->lodLevels[a] = AnimationLod::FULL;
+                continue;
+            }
+            if (!item.isOverlay && item.cameraMask == 0) {
+                animArray->lodLevels[a] = AnimationLod::HIDDEN;
+                continue;
+            }
+
+            const AnimationLod previous = animArray->lodLevels[a];
+            animArray->lodLevels[a] = std::fabs(item.h) * maxZoom < animationLodMinHeight_ ? AnimationLod::REDUCED : AnimationLod::FULL;
+            if (previous != AnimationLod::HIDDEN || animArray->pendingTimes[a] <= 0.0f) {
+                continue;
+            }
+
+            // 숨어 있던 동안의 시간을 한 번에 따라잡음. 크기는 프레임 크기 비율로 다시 맞춤
+            animArray->advance(a, animArray->pendingTimes[a]);
+            animArray->pendingTimes[a] = 0.0f;
+            const SDL_Rect& frame = table.getFrameRect(animArray->firstFrames[a] + animArray->currentFrames[a]);
+            if (item.srcRect.w != 0 && item.srcRect.h != 0) {
+                item.w *= static_cast<float>(frame.w) / static_cast<float>(item.srcRect.w);
+                item.h *= static_cast<float>(frame.h) / static_cast<float>(item.srcRect.h);
+            }
+            item.srcRect = frame;
+        }
+    }
+}
+
+/*
+ * @brief 카메라 하나의 뷰로 모든 레이어의 월드 공간 아이템을 그림. 호출 전에 RenderManager가 해당 카메라 뷰에 있어야 함.
+ *        화면 공간 아이템은 여기서 그리지 않음.
+ */
+void RenderSystem::renderPass(EntityManager& entityManager, size_t cameraIndex) {
+    const uint32_t cameraBit = 1u << cameraIndex;
+
+    for (size_t layer = 0; layer < layerItems_.size(); ++layer) {
+        commandList_.setLayer(static_cast<uint8_t>(layer));
+        // 레이어 렌더러도 RenderManager로 그리므로 정점이 GEOMETRY 명령으로 기록되어 덤프에 남음
+        for (auto& layerRenderer : layerRenderers_) {
+            layerRenderer.render(entityManager, static_cast<RenderLayer>(layer));
+        }
+
+        const auto& items = layerItems_[layer];
+        if (items.empty()) {
+            continue;
+        }
+
+        // 캐시되지 않은 아이템(애니메이션, 화면 공간 등)은 타일 위에 그림
+        const bool isTileDrawn = isStaticLayerReady_[layer] && drawStaticTiles(staticLayers_[layer]);
+        if (isStaticLayerReady_[layer] && !isTileDrawn) {
+            isStaticLayerReady_[layer] = false;
+        }
+
+        for (const DrawItem& item : items) {
+            if (item.isOverlay || (item.cameraMask & cameraBit) == 0 || (isTileDrawn && item.isStaticCached)) {
+                continue;
+            }
+            drawItem(item);
+        }
+    }
+}
+
+void RenderSystem::drawItem(const DrawItem& item) {
+    switch (item.kind) {
+    case DrawItem::Kind::SPRITE:
+        if (item.isRotated && item.isOverlay) {
+            // 화면 공간 스프라이트는 x, y가 좌상단이므로 기준점의 화면 좌표를 직접 계산함
+            const SDL_FRect srcRect = {static_cast<float>(item.srcRect.x), static_cast<float>(item.srcRect.y), static_cast<float>(item.srcRect.w), static_cast<float>(item.srcRect.h)};
+            const SDL_FRect dstRect = {item.x, item.y, item.w, item.h};
+            renderManager_.drawSpriteRotated(item.texture, &srcRect, dstRect, item.sinAngle, item.cosAngle,
+                                             item.x + item.w * item.pivotX, item.y + item.h * item.pivotY, {1.0f, 1.0f, 1.0f, 1.0f}, item.flip);
+        } else if (item.isRotated) {
+            renderManager_.renderTextureRotated(item.texture, item.x, item.y, &item.srcRect, item.w, item.h,
+                                                item.sinAngle, item.cosAngle, item.pivotX, item.pivotY, item.flip);
+        } else if (item.isOverlay) {
+            renderManager_.renderUITexture(item.texture, item.x, item.y, &item.srcRect, item.w, item.h, item.flip);
+        } else {
+            renderManager_.renderTexture(item.texture, item.x, item.y, &item.srcRect, item.w, item.h, item.flip);
+        }
+        break;
+
+    case DrawItem::Kind::TEXT: {
+        float originX = item.x;
+        float originY = item.y;
+        float scaleX = item.w;
+        float scaleY = item.h;
+        if (!item.isOverlay) {
+            // 월드 공간 텍스트는 기존 텍스처 방식처럼 위치를 중심으로 그림
+            renderManager_.worldToScreen(item.x, item.y, originX, originY);
+            scaleX *= renderManager_.getZoomLevel();
+            scaleY *= renderManager_.getZoomLevel();
+            originX -= item.layout->width * scaleX / 2.0f;
+            originY -= item.layout->height * scaleY / 2.0f;
+        }
+
+        for (const auto& quad : item.layout->quads) {
+            const SDL_FRect dstRect = {originX + quad.x * scaleX, originY + quad.y * scaleY, quad.w * scaleX, quad.h * scaleY};
+            renderManager_.drawSprite(item.texture, &quad.srcRect, dstRect, item.color);
+        }
+        break;
+    }
+
+    case DrawItem::Kind::FILL: {
+        int w = 0, h = 0;
+        SDL_GetRenderOutputSize(renderManager_.getRenderer(), &w, &h);
+        const SDL_FRect fadeRect = { 0, 0, static_cast<float>(w), static_cast<float>(h) };
+        const SDL_FColor fadeColor = {item.fillColor.r / 255.0f, item.fillColor.g / 255.0f, item.fillColor.b / 255.0f, item.fillColor.a / 255.0f};
+
+        renderManager_.setDrawBlendMode(SDL_BLENDMODE_BLEND);
+        renderManager_.fillRect(fadeRect, fadeColor);
+        renderManager_.setDrawBlendMode(SDL_BLENDMODE_NONE);
+        break;
+    }
+    }
+}
+
+/*
+ * @brief 정적 레이어의 캐시 상태를 프레임마다 한 번 갱신함.
+ *        buildDrawItems가 계산한 signature나 줌이 바뀌었으면 스프라이트 목록을 다시 만들고 타일을 모두 버림. 타일은 보일 때 lazy하게 다시 구움.
+ *        캐시할 수 없는 엔티티(애니메이션, 화면 공간 등)는 드로우 아이템으로 매 프레임 그려짐.
+ * @return false면 캐시를 쓸 수 없으므로 레이어 전체를 드로우 아이템으로 그려야 함.
+ */
+bool RenderSystem::prepareStaticLayer(EntityManager& entityManager, StaticLayerCache& cache, const std::vector<EntityID>& entities, uint64_t signature, float zoom) {
+    auto renderArray = entityManager.getComponentArray<RenderComponent>();
+    auto transformArray = entityManager.getComponentArray<TransformComponent>();
+    const auto& renderIndexMap = renderArray->getEntityToIndexMap();
+    const auto& transformIndexMap = transformArray->getEntityToIndexMap();
+
+    // 회전 스프라이트는 타일에 굽지 않음. buildDrawItems의 isStaticCached와 같은 조건이어야 함
+    auto isCacheable = [&](size_t r, size_t t) {
+        return renderArray->sdlTextures[r] && !renderArray->hasAnimations[r] && !renderArray->isScreenSpace[r] &&
+               transformArray->rotatedAngle[t] == 0.0f && transformArray->pivotX[t] == 0.5f && transformArray->pivotY[t] == 0.5f;
+    };
+
+    if (zoom <= 0.0f) {
+        return false;
+    }
+
+    // 변경되었으면 스프라이트 목록과 경계를 다시 만들고 타일 폐기
+    if (cache.isDirty || cache.signature != signature || cache.zoom != zoom) {
+        releaseTiles(cache);
+        cache.sprites.clear();
+        cache.minX = cache.minY = INFINITY;
+        cache.maxX = cache.maxY = -INFINITY;
+
+        for (EntityID entity : entities) {
+            const size_t r = renderIndexMap.at(entity);
+            const size_t t = transformIndexMap.at(entity);
+            if (!isCacheable(r, t)) {
+                continue;
+            }
+
+            StaticSprite sprite;
+            sprite.texture = renderArray->sdlTextures[r];
+            sprite.srcRect = {renderArray->srcRectX[r], renderArray->srcRectY[r], renderArray->srcRectW[r], renderArray->srcRectH[r]};
+            sprite.x = transformArray->positionX[t];
+            sprite.y = transformArray->positionY[t];
+            sprite.w = static_cast<float>(renderArray->widths[r] ? renderArray->widths[r] : sprite.srcRect.w) * transformArray->scaleX[t];
+            sprite.h = static_cast<float>(renderArray->heights[r] ? renderArray->heights[r] : sprite.srcRect.h) * transformArray->scaleY[t];
+            sprite.flip = SDL_FLIP_NONE;
+            if (renderArray->flipX[r]) sprite.flip = static_cast<SDL_FlipMode>(sprite.flip | SDL_FLIP_HORIZONTAL);
+            if (renderArray->flipY[r]) sprite.flip = static_cast<SDL_FlipMode>(sprite.flip | SDL_FLIP_VERTICAL);
+
+            cache.minX = std::min(cache.minX, sprite.x - std::fabs(sprite.w) / 2.0f);
+            cache.minY = std::min(cache.minY, sprite.y - std::fabs(sprite.h) / 2.0f);
+            cache.maxX = std::max(cache.maxX, sprite.x + std::fabs(sprite.w) / 2.0f);
+            cache.maxY = std::max(cache.maxY, sprite.y + std::fabs(sprite.h) / 2.0f);
+            cache.sprites.push_back(sprite);
+        }
+
+        cache.signature = signature;
+        cache.zoom = zoom;
+        cache.tileWorldSize = static_cast<float>(STATIC_TILE_SIZE) / zoom;
+        cache.isDirty = false;
+    }
+
+    return true;
+}
+
+/*
+ * @brief 현재 카메라 뷰에 보이는 정적 레이어 타일을 블릿함.
+ * @return false면 렌더 타겟을 쓸 수 없어 캐시를 포기한 것이므로 호출자가 레이어 전체를 직접 그려야 함.
+ */
+bool RenderSystem::drawStaticTiles(StaticLayerCache& cache) {
+    if (cache.sprites.empty()) {
+        return true;
+    }
+
+    // 1. 카메라에 보이는 타일 범위 계산 (레이어 경계로 제한)
+    const float zoom = cache.zoom;
+    const float halfViewW = static_cast<float>(renderManager_.getViewWidth()) / 2.0f / zoom;
+    const float halfViewH = static_cast<float>(renderManager_.getViewHeight()) / 2.0f / zoom;
+    const float viewMinX = std::max(renderManager_.getCameraX() - halfViewW, cache.minX);
+    const float viewMinY = std::max(renderManager_.getCameraY() - halfViewH, cache.minY);
+    const float viewMaxX = std::min(renderManager_.getCameraX() + halfViewW, cache.maxX);
+    const float viewMaxY = std::min(renderManager_.getCameraY() + halfViewH, cache.maxY);
+    if (viewMinX > viewMaxX || viewMinY > viewMaxY) {
+        return true;
+    }
+
+    const float tileSize = cache.tileWorldSize;
+    const int tileX0 = static_cast<int>(std::floor(viewMinX / tileSize));
+    const int tileY0 = static_cast<int>(std::floor(viewMinY / tileSize));
+    const int tileX1 = static_cast<int>(std::floor(viewMaxX / tileSize));
+    const int tileY1 = static_cast<int>(std::floor(viewMaxY / tileSize));
+
+    // 2. 보이는 타일 중 아직 없는 것을 먼저 모두 구움. 하나라도 실패하면 아무것도 블릿하지 않아야
+    //    호출자가 레이어 전체를 드로우 아이템으로 그릴 때 같은 스프라이트가 두 번 그려지지 않음
+    for (int tileY = tileY0; tileY <= tileY1; ++tileY) {
+        for (int tileX = tileX0; tileX <= tileX1; ++tileX) {
+            const int64_t key = tileKey(tileX, tileY);
+            if (auto it = cache.tiles.find(key); it != cache.tiles.end()) {
+                it->second.lastUsedFrame = renderFrame_;
+                continue;
+            }
+            SDL_Texture* tile = nullptr;
+            if (!buildStaticTile(cache, tileX, tileY, tile)) {
+                SDL_Log("RenderSystem::drawStaticTiles - Render target unavailable, disabling static cache for this layer.");
+                cache.isStatic = false;
+                releaseTiles(cache);
+                return false;
+            }
+            cache.tiles.emplace(key, StaticTile{tile, renderFrame_});
+        }
+    }
+
+    // 3. 보이는 타일을 블릿
+    for (int tileY = tileY0; tileY <= tileY1; ++tileY) {
+        for (int tileX = tileX0; tileX <= tileX1; ++tileX) {
+            SDL_Texture* tile = cache.tiles.at(tileKey(tileX, tileY)).texture;
+            if (tile) {
+                renderManager_.renderTexture(tile, (tileX + 0.5f) * tileSize, (tileY + 0.5f) * tileSize, nullptr, tileSize, tileSize);
+            }
+        }
+    }
+
+    // 캐시 크기 제한은 모든 카메라 패스가 끝난 뒤 trimStaticTiles에서 처리함
+    return true;
+}
+
+/*
+ * @brief (tileX, tileY) 타일에 걸치는 스프라이트를 타겟 텍스처 하나에 그림.
+ *        타일 내용은 투명 배경 위에 합성되므로 premultiplied alpha 상태가 되며, 블렌드 모드도 그에 맞춤.
+ * @param outTile 결과 텍스처. 걸치는 스프라이트가 없으면 nullptr.
+ * @return 렌더 타겟 생성 또는 전환 실패 시 false.
+ */
+bool RenderSystem::buildStaticTile(const StaticLayerCache& cache, int tileX, int tileY, SDL_Texture*& outTile) {
+    outTile = nullptr;
+    const float tileSize = cache.tileWorldSize;
+    const float originX = tileX * tileSize;
+    const float originY = tileY * tileSize;
+
+    auto overlapsTile = [&](const StaticSprite& sprite) {
+        const float halfW = std::fabs(sprite.w) / 2.0f;
+        const float halfH = std::fabs(sprite.h) / 2.0f;
+        return sprite.x + halfW > originX && sprite.x - halfW < originX + tileSize &&
+               sprite.y + halfH > originY && sprite.y - halfH < originY + tileSize;
+    };
+
+    if (std::none_of(cache.sprites.begin(), cache.sprites.end(), overlapsTile)) {
+        return true;
+    }
+
+    SDL_Renderer* renderer = renderManager_.getRenderer();
+    SDL_Texture* tile = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, STATIC_TILE_SIZE, STATIC_TILE_SIZE);
+    if (!tile) {
+        SDL_Log("RenderSystem::buildStaticTile - Failed to create tile texture: %s", SDL_GetError());
+        return false;
+    }
+    SDL_SetTextureBlendMode(tile, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDL_SetTextureScaleMode(tile, SDL_SCALEMODE_NEAREST);
+
+    if (!renderManager_.beginOffscreenPass(tile, originX, originY)) {
+        SDL_DestroyTexture(tile);
+        return false;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    for (const auto& sprite : cache.sprites) {
+        if (overlapsTile(sprite)) {
+            renderManager_.renderTexture(sprite.texture, sprite.x, sprite.y, &sprite.srcRect, sprite.w, sprite.h, sprite.flip);
+        }
+    }
+
+    renderManager_.endOffscreenPass();
+    outTile = tile;
+    return true;
+}
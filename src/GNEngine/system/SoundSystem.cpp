@@ -5,15 +5,62 @@
 SoundSystem::SoundSystem(SoundManager& soundManager)
     : soundManager_(soundManager) {}
 
+void SoundSystem::mapAnimationEvent(AnimationEventId event, std::shared_ptr<Sound> sound, SoundPriority priority, float volume, bool spatialized) {
+    if (event == NO_ANIMATION_EVENT) {
+        return;
+    }
+    if (event >= animationEventSounds_.size()) {
+        animationEventSounds_.resize(static_cast<size_t>(event) + 1);
+    }
+    animationEventSounds_[event] = {std::move(sound), priority, volume, spatialized};
+}
+
+/* AnimationSystem이 모아 둔 이벤트를 한 번에 처리함. 같은 버퍼는 한 번만 읽음. */
+void SoundSystem::playAnimationEvents(EntityManager& entityManager) {
+    if (!animationSystem_ || animationSystem_->getEventFrame() == lastEventFrame_) {
+        return;
+    }
+    lastEventFrame_ = animationSystem_->getEventFrame();
+
+    const auto& events = animationSystem_->getEvents();
+    if (events.empty() || animationEventSounds_.empty()) {
+        return;
+    }
+
+    auto transformArray = entityManager.getComponentArray<TransformComponent>();
+    for (const AnimationEvent& event : events) {
+        if (event.event >= animationEventSounds_.size() || !animationEventSounds_[event.event].sound) {
+            continue;
+        }
+        const AnimationEventSound& mapping = animationEventSounds_[event.event];
+
+        Position pos = {0.0f, 0.0f, 0.0f};
+        if (transformArray) {
+            auto it = transformArray->getEntityToIndexMap().find(event.entity);
+            if (it != transformArray->getEntityToIndexMap().end()) {
+                pos = {transformArray->positionX[it->second], transformArray->positionY[it->second], 0.0f};
+            }
+        }
+        soundManager_.playSound(event.entity, mapping.sound.get(), pos, mapping.priority, mapping.volume, 1.0f, false, mapping.spatialized);
+    }
+}
+
 void SoundSystem::update(EntityManager& entityManager, float deltaTime) {
+    // 비동기로 디코딩이 끝난 사운드를 이 스레드에서 버퍼로 올려, 이번 프레임의 재생 요청부터 쓸 수 있게 함
+    soundManager_.uploadPendingSounds();
+    playAnimationEvents(entityManager);
+
     auto soundComponentArray = entityManager.getComponentArray<SoundComponent>();
-    if (!soundComponentArray) {
-        return; // No SoundComponents to process
+    if (soundComponentArray) {
+        processRequests(entityManager, *soundComponentArray);
     }
+    syncVoices(entityManager, soundComponentArray);
+}
 
-    // 컴포넌트를 순회하며 재생/정지 요청 처리
+/* 컴포넌트를 순회하며 재생/정지 요청 처리 */
+void SoundSystem::processRequests(EntityManager& entityManager, ComponentArray<SoundComponent>& soundComponentArray) {
     for (auto entity : entityManager.getEntitiesWith<SoundComponent, TransformComponent>()) {
-        auto& soundComponent = soundComponentArray->getComponent(entity);
+        auto& soundComponent = soundComponentArray.getComponent(entity);
         auto transform = entityManager.getComponent<TransformComponent>(entity).value();
 
         for (auto& pair : soundComponent.getAllSounds()) {
@@ -22,6 +69,11 @@ void SoundSystem::update(EntityManager& entityManager, float deltaTime) {
 
             // 재생 요청 처리
             if (soundData.wantsToPlay) {
+                // 아직 로딩 중이면 요청을 남겨 두고 다음 프레임에 다시 봄. 내려간 사운드는 여기서 다시 불러오기를 시작함. 로딩에 실패했으면 버림
+                if (soundData.resource && !soundManager_.prepareSound(soundData.resource.get())) {
+                    soundData.wantsToPlay = !soundData.resource->isFailed();
+                    continue;
+                }
                 soundData.wantsToPlay = false; // 요청 처리 플래그 리셋
                 Position pos = { transform.positionX_, transform.positionY_, 0.0f };
                 ALuint sourceId = soundManager_.playSound(entity, soundData.resource.get(), pos, soundData.priority, soundData.volume, soundData.pitch, soundData.loop, soundData.spatialized);
@@ -40,41 +92,38 @@ void SoundSystem::update(EntityManager& entityManager, float deltaTime) {
         }
     }
 
-    // 2. SoundManager의 Voice Pool을 순회하며 상태 동기화
-    const auto& sourceIds = soundManager_.getSourceIds();
-    const auto& ownerEntityIds = soundManager_.getOwnerEntityIds();
-    const auto& arePlaying = soundManager_.getArePlayingFlags();
+}
 
-    for (size_t i = 0; i < soundManager_.getVoiceCount(); ++i) {
-        if (arePlaying[i]) {
-            EntityID ownerId = ownerEntityIds[i];
-            if (ownerId == 0) continue; // 주인이 없는 소스는 스킵
+/*
+ * 보이스 상태를 SoundManager에서 한 번에 동기화하고, 끝난 보이스만 컴포넌트에 반영함.
+ * 위치는 사용 중인 보이스만 갱신하므로 풀 크기와 무관함.
+ */
+void SoundSystem::syncVoices(EntityManager& entityManager, ComponentArray<SoundComponent>* soundComponentArray) {
+    soundManager_.syncVoices();
 
-            // 위치 동기화
-            if (auto transformOpt = entityManager.getComponent<TransformComponent>(ownerId)) {
-                auto& transform = transformOpt.value();
-                soundManager_.setSourcePosition(sourceIds[i], transform.positionX_, transform.positionY_, 0.0f);
-            }
+    if (soundComponentArray) {
+        for (const auto& finished : soundManager_.getFinishedVoices()) {
+            if (finished.ownerEntityId == 0 || !soundComponentArray->hasComponent(finished.ownerEntityId)) continue;
 
-            // 재생 완료된 소스 정리
-            ALint state;
-            alGetSourcei(sourceIds[i], AL_SOURCE_STATE, &state);
-            if (state == AL_STOPPED) {
-                if (soundComponentArray->hasComponent(ownerId)) {
-                    auto& soundComp = soundComponentArray->getComponent(ownerId);
-                    // 컴포넌트에서 해당 sourceId를 가진 soundData를 찾아 초기화
-                    for (auto& pair : soundComp.getAllSounds()) {
-                        if (pair.second.sourceId.has_value() && pair.second.sourceId.value() == sourceIds[i]) {
-                            pair.second.sourceId.reset();
-                            break; // 찾았으므로 루프 종료
-                        }
-                    }
+            // 컴포넌트에서 해당 sourceId를 가진 soundData를 찾아 초기화
+            for (auto& pair : soundComponentArray->getComponent(finished.ownerEntityId).getAllSounds()) {
+                if (pair.second.sourceId.has_value() && pair.second.sourceId.value() == finished.sourceId) {
+                    pair.second.sourceId.reset();
+                    break; // 찾았으므로 루프 종료
                 }
-                // SoundManager에게 보이스 반납을 요청 (내부적으로 arePlaying 플래그 등을 false로 만듦)
-                soundManager_.stopSound(sourceIds[i]); 
             }
         }
     }
-}
 
+    const auto& sourceIds = soundManager_.getSourceIds();
+    const auto& ownerEntityIds = soundManager_.getOwnerEntityIds();
+    for (uint32_t i : soundManager_.getActiveVoices()) {
+        EntityID ownerId = ownerEntityIds[i];
+        if (ownerId == 0) continue; // 주인이 없는 소스는 스킵
 
+        if (auto transformOpt = entityManager.getComponent<TransformComponent>(ownerId)) {
+            auto& transform = transformOpt.value();
+            soundManager_.setSourcePosition(sourceIds[i], transform.positionX_, transform.positionY_, 0.0f);
+        }
+    }
+}
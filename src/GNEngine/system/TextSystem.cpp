@@ -10,49 +10,39 @@ TextSystem::TextSystem(EntityManager& entityManager, TextManager& textManager, S
 TextSystem::~TextSystem() {
 }
 
+/*
+ * @brief dirty한 TextComponent를 글리프 아틀라스로 레이아웃함.
+ *        새 글리프가 처음 나올 때만 래스터라이즈하며, 텍스처를 새로 만들거나 파괴하지 않음.
+ *        결과 쿼드는 ComponentArray<TextComponent>::layouts에 저장되고 RenderSystem이 스프라이트 배치로 그림.
+ */
 void TextSystem::update(EntityManager& entityManager, float deltaTime) {
     auto renderComponentArray = entityManager.getComponentArray<RenderComponent>();
     auto textComponentArray = entityManager.getComponentArray<TextComponent>();
     if (!renderComponentArray || !textComponentArray) return;
 
-    for (auto& entity : entityManager_.getEntitiesWith<TextComponent, RenderComponent>()) {
-        auto textComponentOpt = entityManager_.getComponent<TextComponent>(entity);
+    const auto& textIndexMap = textComponentArray->getEntityToIndexMap();
+    const auto& renderIndexMap = renderComponentArray->getEntityToIndexMap();
 
-        if (textComponentOpt && textComponentOpt->isDirty) {
-            auto& textComponent = *textComponentOpt;
-
-            TTF_Font* font = textManager_.getFont(textComponent.fontPath, textComponent.fontSize);
-            if (!font) {
-                SDL_Log("TextSystem::update - Font not found for path: %s, size: %d", textComponent.fontPath.string().c_str(), textComponent.fontSize);
-                continue;
-            }
-
-            SDL_Surface* surface = TTF_RenderText_Blended(font, textComponent.text.c_str(), textComponent.text.length(), textComponent.color);
-
-            if (!surface) {
-                SDL_Log("TextSystem::update - Failed to create surface from text: %s", SDL_GetError());
-                continue;
-            }
+    for (auto& entity : entityManager.getEntitiesWith<TextComponent, RenderComponent>()) {
+        const size_t i = textIndexMap.at(entity);
+        if (!textComponentArray->areDirty[i]) {
+            continue;
+        }
 
-            SDL_Texture* newTexture = SDL_CreateTextureFromSurface(renderer_, surface);
-            if (!newTexture) {
-                SDL_DestroySurface(surface);
-                SDL_Log("TextSystem::update - Failed to create texture from surface: %s", SDL_GetError());
-                continue;
-            }
+        GlyphAtlas* atlas = textManager_.getGlyphAtlas(textComponentArray->fontPaths[i], textComponentArray->fontSizes[i]);
+        if (!atlas) {
+            SDL_Log("TextSystem::update - Font not found for path: %s, size: %d", textComponentArray->fontPaths[i].string().c_str(), textComponentArray->fontSizes[i]);
+            continue;
+        }
 
-            int textureWidth = surface->w;
-            int textureHeight = surface->h;
+        auto& layout = textComponentArray->layouts[i];
+        atlas->layoutText(textComponentArray->texts[i], layout);
 
-            SDL_DestroySurface(surface);
+        // RenderComponent에는 텍스처 없이 크기만 기록함. (정렬/배치 계산용)
+        const size_t r = renderIndexMap.at(entity);
+        renderComponentArray->widths[r] = static_cast<int>(layout.width);
+        renderComponentArray->heights[r] = static_cast<int>(layout.height);
 
-            renderComponentArray->updateTexture(entity, newTexture, textureWidth, textureHeight);
-            textComponentArray->setDirty(entity, false);
-            
-            auto transformComp = entityManager.getComponent<TransformComponent>(entity);
-            // SDL_Log("--- TEXT SYSTEM DEBUG --- Text: '%s' | Position: (%.2f, %.2f) | Texture Size: (%d, %d)", textComponent.text.c_str(), transformComp->positionX_, transformComp->positionY_, textureWidth, textureHeight);
-        } else if (textComponentOpt && !textComponentOpt->isDirty) {
-            // SDL_Log("TextSystem::update - TextComponent is not dirty, skipping texture regeneration.");
-        }
+        textComponentArray->areDirty[i] = false;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,141 @@
+#include "GNEngine/system/TilemapRenderSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <SDL3/SDL_render.h>
+
+TilemapRenderSystem::TilemapRenderSystem(RenderManager& renderManager)
+    : renderManager_(renderManager) {}
+
+void TilemapRenderSystem::update(EntityManager& entityManager, [[maybe_unused]] float deltaTime) {
+    ++frame_;
+
+    auto tilemapArray = entityManager.getComponentArray<TilemapComponent>();
+    if (!tilemapArray || frame_ % GEOMETRY_KEEP_FRAMES != 0) {
+        return;
+    }
+
+    for (EntityID entity : entityManager.getEntitiesWith<TilemapComponent>()) {
+        for (auto& chunk : tilemapArray->getComponent(entity).getChunks()) {
+            if (!chunk.vertices.empty() && chunk.lastDrawnFrame + GEOMETRY_KEEP_FRAMES < frame_) {
+                std::vector<SDL_Vertex>().swap(chunk.vertices);
+                chunk.isGeometryDirty = true;
+            }
+        }
+    }
+}
+
+/*
+ * @brief 청크의 비어 있지 않은 타일마다 쿼드 4개 정점을 월드 좌표로 만듦.
+ */
+void TilemapRenderSystem::buildChunkGeometry(const TilemapComponent& tilemap, TilemapComponent::Chunk& chunk, int chunkX, int chunkY) {
+    constexpr int CHUNK_SIZE = TilemapComponent::CHUNK_SIZE;
+    const float tileW = static_cast<float>(tilemap.getTileWidth());
+    const float tileH = static_cast<float>(tilemap.getTileHeight());
+    const float invAtlasW = tilemap.getAtlasWidth() > 0.0f ? 1.0f / tilemap.getAtlasWidth() : 0.0f;
+    const float invAtlasH = tilemap.getAtlasHeight() > 0.0f ? 1.0f / tilemap.getAtlasHeight() : 0.0f;
+    const int columns = tilemap.getAtlasColumns();
+    const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    chunk.vertices.clear();
+    chunk.vertices.reserve(static_cast<size_t>(chunk.tileCount) * 4);
+
+    for (int localY = 0; localY < CHUNK_SIZE; ++localY) {
+        for (int localX = 0; localX < CHUNK_SIZE; ++localX) {
+            const uint16_t tile = chunk.tiles[localY * CHUNK_SIZE + localX];
+            if (tile == TilemapComponent::EMPTY_TILE) {
+                continue;
+            }
+
+            const int atlasIndex = tile - 1;
+            const float u0 = (atlasIndex % columns) * tileW * invAtlasW;
+            const float v0 = (atlasIndex / columns) * tileH * invAtlasH;
+            const float u1 = u0 + tileW * invAtlasW;
+            const float v1 = v0 + tileH * invAtlasH;
+
+            const float x0 = tilemap.getOriginX() + (chunkX * CHUNK_SIZE + localX) * tileW;
+            const float y0 = tilemap.getOriginY() + (chunkY * CHUNK_SIZE + localY) * tileH;
+            const float x1 = x0 + tileW;
+            const float y1 = y0 + tileH;
+
+            chunk.vertices.push_back({{x0, y0}, white, {u0, v0}});
+            chunk.vertices.push_back({{x1, y0}, white, {u1, v0}});
+            chunk.vertices.push_back({{x1, y1}, white, {u1, v1}});
+            chunk.vertices.push_back({{x0, y1}, white, {u0, v1}});
+        }
+    }
+    chunk.isGeometryDirty = false;
+}
+
+void TilemapRenderSystem::renderLayer(EntityManager& entityManager, RenderLayer layer) {
+    auto tilemapArray = entityManager.getComponentArray<TilemapComponent>();
+    if (!tilemapArray) {
+        return;
+    }
+
+    const float zoom = renderManager_.getZoomLevel();
+    const float cameraX = renderManager_.getCameraX();
+    const float cameraY = renderManager_.getCameraY();
+    const float halfScreenW = renderManager_.getViewWidth() / 2.0f;
+    const float halfScreenH = renderManager_.getViewHeight() / 2.0f;
+    if (zoom <= 0.0f) {
+        return;
+    }
+
+    for (EntityID entity : entityManager.getEntitiesWith<TilemapComponent>()) {
+        auto& tilemap = tilemapArray->getComponent(entity);
+        if (tilemap.getLayer() != layer || !tilemap.getAtlas()) {
+            continue;
+        }
+
+        // 1. 카메라에 보이는 월드 영역을 청크 범위로 변환
+        const float chunkWorldW = static_cast<float>(TilemapComponent::CHUNK_SIZE * tilemap.getTileWidth());
+        const float chunkWorldH = static_cast<float>(TilemapComponent::CHUNK_SIZE * tilemap.getTileHeight());
+        const float viewMinX = cameraX - halfScreenW / zoom - tilemap.getOriginX();
+        const float viewMinY = cameraY - halfScreenH / zoom - tilemap.getOriginY();
+        const float viewMaxX = cameraX + halfScreenW / zoom - tilemap.getOriginX();
+        const float viewMaxY = cameraY + halfScreenH / zoom - tilemap.getOriginY();
+
+        const int chunkX0 = std::max(static_cast<int>(std::floor(viewMinX / chunkWorldW)), 0);
+        const int chunkY0 = std::max(static_cast<int>(std::floor(viewMinY / chunkWorldH)), 0);
+        const int chunkX1 = std::min(static_cast<int>(std::floor(viewMaxX / chunkWorldW)), tilemap.getChunksX() - 1);
+        const int chunkY1 = std::min(static_cast<int>(std::floor(viewMaxY / chunkWorldH)), tilemap.getChunksY() - 1);
+
+        // 2. 보이는 청크마다 캐시된 정점을 화면 좌표로 옮겨 스프라이트 배치에 넣음. 같은 아틀라스의 청크는 한 번에 그려짐
+        for (int chunkY = chunkY0; chunkY <= chunkY1; ++chunkY) {
+            for (int chunkX = chunkX0; chunkX <= chunkX1; ++chunkX) {
+                auto& chunk = tilemap.getChunk(chunkX, chunkY);
+                if (chunk.tileCount == 0) {
+                    continue;
+                }
+                if (chunk.isGeometryDirty) {
+                    buildChunkGeometry(tilemap, chunk, chunkX, chunkY);
+                }
+                chunk.lastDrawnFrame = frame_;
+
+                screenVertices_.resize(chunk.vertices.size());
+                for (size_t i = 0; i < chunk.vertices.size(); ++i) {
+                    screenVertices_[i] = chunk.vertices[i];
+                    screenVertices_[i].position.x = (chunk.vertices[i].position.x - cameraX) * zoom + halfScreenW;
+                    screenVertices_[i].position.y = (chunk.vertices[i].position.y - cameraY) * zoom + halfScreenH;
+                }
+
+                renderManager_.drawQuads(tilemap.getAtlas(), screenVertices_.data(), screenVertices_.size() / 4);
+            }
+        }
+    }
+}
+
+uint64_t TilemapRenderSystem::getRevision(EntityManager& entityManager) {
+    auto tilemapArray = entityManager.getComponentArray<TilemapComponent>();
+    if (!tilemapArray) {
+        return 0;
+    }
+
+    uint64_t revision = 0;
+    for (EntityID entity : entityManager.getEntitiesWith<TilemapComponent>()) {
+        const uint64_t value = (static_cast<uint64_t>(entity) << 40) ^ tilemapArray->getComponent(entity).getRevision();
+        revision ^= value + 0x9e3779b97f4a7c15ULL + (revision << 6) + (revision >> 2);
+    }
+    return revision;
+}